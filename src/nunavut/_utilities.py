@@ -13,6 +13,8 @@ A small collection of common utilities.
 
 """
 import enum
+import functools
+import hashlib
 import logging
 import pathlib
 from typing import Generator, cast
@@ -135,3 +137,26 @@ def empty_list_support_files() -> Generator[pathlib.Path, None, None]:
     """
     # works in Python 3.3 and newer. Thanks https://stackoverflow.com/a/13243870
     yield from ()
+
+
+@functools.lru_cache(maxsize=None)
+def package_digest() -> str:
+    """
+    Digest of the sources of the Nunavut package itself: its python modules, built-in templates, configuration, and
+    support headers. Caches keyed on this digest are invalidated by any change to Nunavut, not only by a new release.
+
+    >>> from nunavut._utilities import package_digest
+    >>> len(package_digest())
+    64
+    >>> package_digest() == package_digest()
+    True
+
+    """
+    package_path = pathlib.Path(__file__).parent
+    hasher = hashlib.sha256()
+    for package_file in sorted(package_path.rglob("*")):
+        if package_file.is_file() and package_file.suffix in (".py", ".j2", ".yaml", ".h", ".hpp"):
+            hasher.update(package_file.relative_to(package_path).as_posix().encode("utf-8"))
+            hasher.update(b"\0")
+            hasher.update(package_file.read_bytes())
+    return hasher.hexdigest()
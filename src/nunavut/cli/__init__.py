@@ -208,6 +208,61 @@ def _make_parser() -> argparse.ArgumentParser:
         ).lstrip(),
     )
 
+    parser.add_argument(
+        "--jobs",
+        "-j",
+        type=int,
+        default=1,
+        help=textwrap.dedent(
+            """
+        The number of processes to generate types in. 0 uses one
+        process per CPU. Parallel generation needs a platform that
+        can fork processes; elsewhere types are generated one after
+        the other.
+
+    """
+        ).lstrip(),
+    )
+
+    parser.add_argument(
+        "--incremental",
+        action="store_true",
+        help=textwrap.dedent(
+            """
+        Keep a manifest in the output directory (one per target
+        language and root namespace) and only generate the types
+        whose DSDL, or the DSDL of a type they depend on, changed
+        since the last run. Changing templates, options, or the
+        version of nunavut generates everything again. Files
+        whose contents did not change are never written so their
+        modification times are kept.
+
+    """
+        ).lstrip(),
+    )
+
+    parser.add_argument(
+        "--template-cache-dir",
+        type=pathlib.Path,
+        help=textwrap.dedent(
+            """
+        Directory to cache compiled templates in. Defaults to
+        nunavut/templates under the user's cache directory
+        (XDG_CACHE_HOME or ~/.cache). The cache is keyed on the
+        contents of the templates, the version of nunavut, and the
+        language options so it can be shared by any number of nnvg
+        invocations, including concurrent ones.
+
+    """
+        ).lstrip(),
+    )
+
+    parser.add_argument(
+        "--no-template-cache",
+        action="store_true",
+        help="Compile all templates on every invocation instead of using the template cache.",
+    )
+
     parser.add_argument(
         "--generate-support",
         choices=["always", "never", "as-needed", "only"],
@@ -254,6 +309,11 @@ def _make_parser() -> argparse.ArgumentParser:
         the default value for the --namespace-output-stem argument and can be
         changed using that argument.
 
+        For C++ each namespace header includes the types of the namespace and of
+        those nested in it, and defines a PortDispatch class template holding
+        tables, sorted by fixed port-ID, of their EXTENT_BYTES and serialization
+        functions.
+
     """
         ).lstrip(),
     )
@@ -489,6 +549,170 @@ def _make_parser() -> argparse.ArgumentParser:
         ).lstrip(),
     )
 
+    ln_opt_group.add_argument(
+        "--disable-unchecked-fixed-length-serialization",
+        action="store_true",
+        help=textwrap.dedent(
+            """
+
+        By default, generated serialization routines for fixed-length types check the buffer
+        capacity once for the whole object and then write every field without further bounds
+        checks. This option restores the per-field checks for these types. Only C++ generators
+        support this option; it has no effect when --enable-override-variable-array-capacity is set.
+
+    """
+        ).lstrip(),
+    )
+
+    ln_opt_group.add_argument(
+        "--enable-allocator-support",
+        action="store_true",
+        help=textwrap.dedent(
+            """
+
+        Generate variable-length arrays that use an arena-aware allocator and emit deserialize overloads
+        that take an arena. All variable-length members of a message, including those of nested types, are
+        then allocated from that one region which can be released at once. Only C++ generators using the
+        built-in variable-length array type support this option.
+
+    """
+        ).lstrip(),
+    )
+
+    ln_opt_group.add_argument(
+        "--enable-view-types",
+        action="store_true",
+        help=textwrap.dedent(
+            """
+
+        Generate a nested View class in every composite type that reads a serialized object in place,
+        decoding each field only when its accessor is called. Byte arrays are returned as spans into the
+        buffer rather than copied. Only supported by C++ generators.
+
+    """
+        ).lstrip(),
+    )
+
+    ln_opt_group.add_argument(
+        "--enable-stream-serialization",
+        action="store_true",
+        help=textwrap.dedent(
+            """
+
+        Generate nested StreamWriter and StreamReader state machines in every composite type so that
+        objects can be serialized and deserialized a chunk of any size at a time, through a small staging
+        buffer instead of one that holds the whole object. Only supported by C++ generators.
+
+    """
+        ).lstrip(),
+    )
+
+    ln_opt_group.add_argument(
+        "--variable-array-inline-below-bytes",
+        type=int,
+        metavar="BYTES",
+        help=textwrap.dedent(
+            """
+
+        Keep the elements of a variable-length array inside the generated object, without any allocation,
+        when its maximum size in elements times the size of the element type is less than BYTES. Larger
+        arrays are allocated as usual. Only C++ generators using the built-in variable-length array type
+        support this option.
+
+    """
+        ).lstrip(),
+    )
+
+    ln_opt_group.add_argument(
+        "--enable-out-of-line-serialization",
+        action="store_true",
+        help=textwrap.dedent(
+            """
+
+        Only declare the serialization functions of each type in its header and define them in a source
+        file generated next to it (e.g. Heartbeat_1_0.cpp). Translation units including many headers then
+        compile faster, and the code is not duplicated across them, but the source files must be compiled
+        and linked. Only supported by C++ generators.
+
+    """
+        ).lstrip(),
+    )
+
+    ln_opt_group.add_argument(
+        "--inline-serialization-types",
+        metavar="PATTERNS",
+        help=textwrap.dedent(
+            """
+
+        With --enable-out-of-line-serialization, keep the serialization functions of the types matching
+        any of these comma-separated patterns inline in their headers (e.g. "uavcan.node.Heartbeat,reg.*")
+        so that the compiler can optimize them at each call site. Patterns are matched against the full name
+        of a type, with and without its version.
+
+    """
+        ).lstrip(),
+    )
+
+    ln_opt_group.add_argument(
+        "--table-serialization-types",
+        metavar="PATTERNS",
+        help=textwrap.dedent(
+            """
+
+        Generate a compact table of the fields of each type matching any of these comma-separated patterns
+        (e.g. "uavcan.*,reg.udral.service.*") instead of serialization code of its own. One interpreter in
+        the support library serializes all of them, which trades some speed for much less code. Patterns are
+        matched against the full name of a type, with and without its version. Only supported by C++
+        generators.
+
+    """
+        ).lstrip(),
+    )
+
+    ln_opt_group.add_argument(
+        "--enable-serialization-tracing",
+        action="store_true",
+        help=textwrap.dedent(
+            """
+
+        Report the duration, size and result of every serialize() and deserialize() call, and each
+        unaligned bit copy, to the tracer named by the NUNAVUT_SUPPORT_TRACER macro. The default tracer
+        does nothing and is optimized away. Only supported by C++ generators.
+
+    """
+        ).lstrip(),
+    )
+
+    ln_opt_group.add_argument(
+        "--enable-deserialization-reuse",
+        action="store_true",
+        help=textwrap.dedent(
+            """
+
+        Generate deserialize() functions for objects that are deserialized into again and again, like the
+        message of a subscriber. When the union tag of the input selects the alternative the object already
+        holds, it is overwritten in place instead of being destroyed and constructed again, so it keeps the
+        capacity of its arrays. Only supported by C++ generators.
+
+    """
+        ).lstrip(),
+    )
+
+    ln_opt_group.add_argument(
+        "--unaligned-copy-engine",
+        choices=["bytewise", "word", "simd"],
+        help=textwrap.dedent(
+            """
+
+        Select the algorithm support headers use to copy bit sequences that are not byte-aligned.
+        bytewise moves at most eight bits per iteration, word shifts and merges whole 64-bit words,
+        and simd additionally uses SSE2 or NEON vectors where the target compiler provides them.
+        All engines produce identical output.
+
+    """
+        ).lstrip(),
+    )
+
     ln_opt_group.add_argument(
         "--language-standard",
         "-std",
@@ -102,6 +102,9 @@ class ArgparseRunner:
             "trim_blocks": self._args.trim_blocks,
             "lstrip_blocks": self._args.lstrip_blocks,
             "post_processors": self._build_post_processor_list_from_args(),
+            "jobs": self._args.jobs,
+            "manifest_path": self._create_manifest_path(language_context) if self._args.incremental else None,
+            "template_cache_dir": self._create_template_cache_dir(),
         }
 
         self._generators = create_generators(self._root_namespace, **generator_args)
@@ -166,6 +169,28 @@ class ArgparseRunner:
         language_options["omit_float_serialization_support"] = self._args.omit_float_serialization_support
         language_options["enable_serialization_asserts"] = self._args.enable_serialization_asserts
         language_options["enable_override_variable_array_capacity"] = self._args.enable_override_variable_array_capacity
+        if self._args.disable_unchecked_fixed_length_serialization:
+            language_options["enable_unchecked_fixed_length_serialization"] = False
+        if self._args.enable_allocator_support:
+            language_options["enable_allocator_support"] = True
+        if self._args.enable_view_types:
+            language_options["enable_view_types"] = True
+        if self._args.enable_stream_serialization:
+            language_options["enable_stream_serialization"] = True
+        if self._args.variable_array_inline_below_bytes is not None:
+            language_options["variable_array_inline_below_bytes"] = self._args.variable_array_inline_below_bytes
+        if self._args.enable_out_of_line_serialization:
+            language_options["enable_out_of_line_serialization"] = True
+        if self._args.inline_serialization_types is not None:
+            language_options["inline_serialization_types"] = self._args.inline_serialization_types
+        if self._args.table_serialization_types is not None:
+            language_options["table_serialization_types"] = self._args.table_serialization_types
+        if self._args.enable_serialization_tracing:
+            language_options["enable_serialization_tracing"] = True
+        if self._args.enable_deserialization_reuse:
+            language_options["enable_deserialization_reuse"] = True
+        if self._args.unaligned_copy_engine is not None:
+            language_options["unaligned_copy_engine"] = self._args.unaligned_copy_engine
         if self._args.language_standard is not None:
             language_options["std"] = self._args.language_standard
 
@@ -218,6 +243,25 @@ class ArgparseRunner:
                 )
         return language_context
 
+    def _create_template_cache_dir(self) -> typing.Optional[pathlib.Path]:
+        if self._args.no_template_cache:
+            return None
+        elif self._args.template_cache_dir is not None:
+            return pathlib.Path(self._args.template_cache_dir)
+        else:
+            return nunavut.jinja.environment.default_template_cache_dir()
+
+    def _create_manifest_path(self, language_context: nunavut.lang.LanguageContext) -> pathlib.Path:
+        """
+        One manifest per target language and root namespace so that generating several namespaces, or languages,
+        into the same output directory does not invalidate, or race on, each other's manifests.
+        """
+        target_language = language_context.get_target_language()
+        return pathlib.Path(self._args.outdir) / ".nunavut-{}-{}.manifest.json".format(
+            "any" if target_language is None else target_language.name,
+            pathlib.Path(self._args.root_namespace).resolve().name,
+        )
+
     # +---------------------------------------------------------------------------------------------------------------+
     # | PRIVATE :: RUN METHODS
     # +---------------------------------------------------------------------------------------------------------------+
@@ -95,7 +95,8 @@ class DependencyBuilder:
     ) -> Dependencies:
         results = Dependencies()
         for dependant in dependant_types:
-            if isinstance(dependant, pydsdl.UnionType):
+            # Delimited types wrap the structure or union they were defined as.
+            if isinstance(getattr(dependant, "inner_type", dependant), pydsdl.UnionType):
                 # Unions always require integer for the tag field.
                 results.uses_integer = True
                 results.uses_union = True
@@ -95,10 +95,12 @@ def create_generators(
     Create the two generators used by Nunavut; a code-generator and a support-library generator.
 
     :param nunavut.Namespace namespace: The namespace to generate code within.
-    :param kwargs: A list of arguments that are forwarded to the generator constructors.
+    :param kwargs: A list of arguments that are forwarded to the generator constructors. ``jobs`` and
+        ``manifest_path`` only apply to the code-generator.
     :return: Tuple with the first item being the code-generator and the second the support-library
         generator.
     """
     from nunavut.jinja import DSDLCodeGenerator, SupportGenerator
 
-    return (DSDLCodeGenerator(namespace, **kwargs), SupportGenerator(namespace, **kwargs))
+    support_kwargs = {k: v for k, v in kwargs.items() if k not in ("jobs", "manifest_path")}
+    return (DSDLCodeGenerator(namespace, **kwargs), SupportGenerator(namespace, **support_kwargs))
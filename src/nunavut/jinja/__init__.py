@@ -8,8 +8,13 @@
 """
 
 import datetime
+import filecmp
+import hashlib
 import io
+import json
 import logging
+import multiprocessing
+import os
 import pathlib
 import re
 import shutil
@@ -18,14 +23,16 @@ import typing
 import nunavut.generators
 import nunavut.lang
 import nunavut.postprocessors
+import nunavut.version
 import pydsdl
-from nunavut._utilities import ResourceType, YesNoDefault
+from nunavut._utilities import ResourceType, YesNoDefault, package_digest
 from yaml import Dumper as YamlDumper
 from yaml import dump as yaml_dump
 
 from .environment import CodeGenEnvironment
 from .jinja2 import Template
 from .loaders import DEFAULT_TEMPLATE_PATH, TEMPLATE_SUFFIX, DSDLTemplateLoader
+from ..manifest import GenerationManifest
 
 logger = logging.getLogger(__name__)
 
@@ -71,6 +78,10 @@ class CodeGenerator(nunavut.generators.AbstractGenerator):
                                             specified). For example, if the target language is ``c`` and this parameter
                                             was set to ``foo`` then built-in templates would be loaded from
                                             ``nunavut.lang.c.foo``.
+    :param template_cache_dir: If provided, compiled templates are cached in this directory and reused by every
+                                            generator, in this process or any other, using the same templates and
+                                            configuration. See :class:`nunavut.jinja.environment.TemplateBytecodeCache`.
+    :type template_cache_dir: typing.Optional[pathlib.Path]
     :raises RuntimeError: If any additional filter or test attempts to replace a built-in
                           or otherwise already defined filter or test.
     """
@@ -155,6 +166,7 @@ class CodeGenerator(nunavut.generators.AbstractGenerator):
         additional_globals: typing.Optional[typing.Dict[str, typing.Any]] = None,
         post_processors: typing.Optional[typing.List["nunavut.postprocessors.PostProcessor"]] = None,
         builtin_template_path: str = DEFAULT_TEMPLATE_PATH,
+        template_cache_dir: typing.Optional[pathlib.Path] = None,
     ):
 
         super().__init__(namespace, generate_namespace_types)
@@ -184,6 +196,7 @@ class CodeGenerator(nunavut.generators.AbstractGenerator):
             additional_filters=additional_filters,
             additional_tests=additional_tests,
             additional_globals=additional_globals,
+            bytecode_cache_dir=template_cache_dir,
         )
 
     @property
@@ -204,6 +217,25 @@ class CodeGenerator(nunavut.generators.AbstractGenerator):
             else:
                 raise PermissionError("{} exists and allow_overwrite is False.".format(output_path))
 
+    @staticmethod
+    def _write_if_changed(output_path: pathlib.Path, contents: str) -> bool:
+        """
+        Write the file unless it already has these contents; leaving it alone keeps its modification time so that
+        build systems do not rebuild what depends on it.
+
+        :return: True if the file was written.
+        """
+        try:
+            with open(str(output_path), "r") as existing_file:
+                if existing_file.read() == contents:
+                    logger.debug("%s is unchanged.", output_path)
+                    return False
+        except (FileNotFoundError, UnicodeDecodeError):
+            pass
+        with open(str(output_path), "w") as output_file:
+            output_file.write(contents)
+        return True
+
     # +-----------------------------------------------------------------------+
     # | AbstractGenerator
     # +-----------------------------------------------------------------------+
@@ -300,15 +332,17 @@ class CodeGenerator(nunavut.generators.AbstractGenerator):
                     raise ValueError("PostProcessor type {} is unknown.".format(type(pp)))
         logger.debug("Using post-processors: %r %r", line_pps, file_pps)
 
+        rendered = io.StringIO()
+        if len(line_pps) > 0:
+            # The logic gets much more complex when doing line post-processing.
+            self._generate_with_line_buffer(rendered, template_gen, line_pps)
+        else:
+            for part in template_gen:
+                rendered.write(part)
+
         self._handle_overwrite(output_path, allow_overwrite)
         output_path.parent.mkdir(parents=True, exist_ok=True)
-        with open(str(output_path), "w") as output_file:
-            if len(line_pps) > 0:
-                # The logic gets much more complex when doing line post-processing.
-                self._generate_with_line_buffer(output_file, template_gen, line_pps)
-            else:
-                for part in template_gen:
-                    output_file.write(part)
+        self._write_if_changed(output_path, rendered.getvalue())
         for file_pp in file_pps:
             output_path = file_pp(output_path)
 
@@ -322,6 +356,16 @@ class DSDLCodeGenerator(CodeGenerator):
     """
     :class:`~CodeGenerator` implementation that generates code for a given set
     of DSDL types.
+
+    :param nunavut.Namespace namespace: The top-level namespace to generates code at and from.
+    :param int jobs:                    The number of processes to render types in. 1 renders everything in this
+                                        process and 0 uses one process per CPU. Parallel rendering needs the ``fork``
+                                        start method; where it is not available types are rendered serially.
+    :param manifest_path:               If provided, a :class:`nunavut.manifest.GenerationManifest` is kept at this
+                                        path and types whose DSDL, dependencies, templates, and options did not change
+                                        since the manifest was written are not generated again.
+    :type manifest_path: typing.Optional[pathlib.Path]
+    :param kwargs:                      See :class:`~CodeGenerator`.
     """
 
     # +-----------------------------------------------------------------------+
@@ -662,12 +706,20 @@ class DSDLCodeGenerator(CodeGenerator):
 
     # +-----------------------------------------------------------------------+
 
-    def __init__(self, namespace: nunavut.Namespace, **kwargs: typing.Any):
+    def __init__(
+        self,
+        namespace: nunavut.Namespace,
+        jobs: int = 1,
+        manifest_path: typing.Optional[pathlib.Path] = None,
+        **kwargs: typing.Any
+    ):
 
         super().__init__(namespace, **kwargs)
         for test_name, test in self._create_all_dsdl_tests().items():
             self._env.add_test(test_name, test)
         self._env.add_conventional_methods_to_environment(self)
+        self._jobs = jobs if jobs > 0 else (os.cpu_count() or 1)
+        self._manifest_path = manifest_path
 
     # +-----------------------------------------------------------------------+
     # | AbstractGenerator
@@ -676,9 +728,42 @@ class DSDLCodeGenerator(CodeGenerator):
     def generate_all(self, is_dryrun: bool = False, allow_overwrite: bool = True) -> typing.Iterable[pathlib.Path]:
         generated = []  # type: typing.List[pathlib.Path]
         provider = self.namespace.get_all_types if self.generate_namespace_types else self.namespace.get_all_datatypes
+
+        manifest = None  # type: typing.Optional[GenerationManifest]
+        if self._manifest_path is not None and not is_dryrun:
+            manifest = GenerationManifest(self._manifest_path, self._generator_digest())
+
+        target_language = self.language_context.get_target_language()
+        work = []  # type: typing.List[_GenerationWork]
         for (parsed_type, output_path) in provider():
-            logger.info("Generating: %s", parsed_type)
-            generated.append(self._generate_type(parsed_type, output_path, is_dryrun, allow_overwrite))
+            outputs = [(None, output_path)]  # type: typing.List[typing.Tuple[typing.Optional[str], pathlib.Path]]
+            fingerprint = None  # type: typing.Optional[str]
+            if isinstance(parsed_type, pydsdl.CompositeType):
+                if target_language is not None:
+                    outputs += target_language.get_implementation_outputs(parsed_type, output_path)
+                if manifest is not None:
+                    fingerprint = manifest.fingerprint(parsed_type)
+            for (template_name, path) in outputs:
+                generated.append(path)
+                # Namespace outputs list their members so they are always generated again. They are cheap.
+                if fingerprint is not None and manifest is not None and manifest.is_current(path, fingerprint):
+                    logger.info("Up to date: %s", path)
+                    manifest.keep(path)
+                    continue
+                logger.info("Generating: %s", parsed_type if template_name is None else path)
+                work.append((parsed_type, path, fingerprint, template_name))
+
+        if self._jobs > 1 and len(work) > 1 and "fork" in multiprocessing.get_all_start_methods():
+            self._generate_in_pool(work, is_dryrun, allow_overwrite)
+        else:
+            for (parsed_type, output_path, _, template_name) in work:
+                self._generate_type(parsed_type, output_path, is_dryrun, allow_overwrite, template_name)
+
+        if manifest is not None:
+            for (_, output_path, fingerprint, _) in work:
+                if fingerprint is not None:
+                    manifest.record(output_path, fingerprint)
+            manifest.save()
         return generated
 
     # +-----------------------------------------------------------------------+
@@ -748,15 +833,88 @@ class DSDLCodeGenerator(CodeGenerator):
         return all_tests
 
     def _generate_type(
-        self, input_type: pydsdl.CompositeType, output_path: pathlib.Path, is_dryrun: bool, allow_overwrite: bool
+        self,
+        input_type: pydsdl.CompositeType,
+        output_path: pathlib.Path,
+        is_dryrun: bool,
+        allow_overwrite: bool,
+        template_name: typing.Optional[str] = None,
     ) -> pathlib.Path:
-        template_name = self.filter_type_to_template(input_type)
+        """
+        :param template_name: The template to use instead of the one found for the type of ``input_type``.
+        """
+        if template_name is None:
+            template_name = self.filter_type_to_template(input_type)
         template = self._env.get_template(template_name)
         template_gen = template.generate(T=input_type)
         if not is_dryrun:
             self._generate_code(output_path, template, template_gen, allow_overwrite)
         return output_path
 
+    def _generate_in_pool(
+        self,
+        work: typing.List["_GenerationWork"],
+        is_dryrun: bool,
+        allow_overwrite: bool,
+    ) -> None:
+        """
+        Render the types in forked worker processes. The workers inherit this generator, and the namespace it was
+        built from, so only indices into the work list cross the process boundary.
+        """
+        global _worker_state
+        _worker_state = (self, work, is_dryrun, allow_overwrite)
+        try:
+            with multiprocessing.get_context("fork").Pool(min(self._jobs, len(work))) as pool:
+                pool.map(_generate_type_in_worker, range(len(work)))
+        finally:
+            _worker_state = None
+
+    def _generator_digest(self) -> str:
+        """
+        Digest of everything other than the DSDL that affects the generated types: the version of nunavut and its
+        built-in templates, the templates found by the loader, the language configuration and options, and the
+        post-processors.
+        """
+        hasher = hashlib.sha256()
+
+        def _update(value: typing.Any) -> None:
+            hasher.update(json.dumps(value, sort_keys=True, default=str).encode("utf-8"))
+            hasher.update(b"\0")
+
+        _update([nunavut.version.__version__, package_digest()])
+        for template in sorted(self.get_templates()):
+            _update(str(template))
+            hasher.update(template.read_bytes())
+
+        language_context = self.language_context
+        _update(language_context.config.sections())
+        target_language = language_context.get_target_language()
+        if target_language is not None:
+            _update([target_language.name, target_language.extension, target_language.get_options()])
+            _update([target_language.support_namespace, target_language.omit_serialization_support])
+
+        _update([self.generate_namespace_types, self._env.trim_blocks, self._env.lstrip_blocks])
+        for pp in self._post_processors or []:
+            # Leave out running state, like the counter of LimitEmptyLines, so that only the configuration counts.
+            _update([type(pp).__name__, {k: v for k, v in vars(pp).items() if not k.endswith("_count")}])
+        return hasher.hexdigest()
+
+
+#: The type, output path, manifest fingerprint, and template (if not the default one) of a file to generate.
+_GenerationWork = typing.Tuple[typing.Any, pathlib.Path, typing.Optional[str], typing.Optional[str]]
+
+_worker_state = None  # type: typing.Optional[typing.Tuple[DSDLCodeGenerator, typing.List[_GenerationWork], bool, bool]]
+
+
+def _generate_type_in_worker(index: int) -> None:
+    """
+    Pool task used by :meth:`DSDLCodeGenerator._generate_in_pool`. Must be at module level to be picklable.
+    """
+    assert _worker_state is not None
+    generator, work, is_dryrun, allow_overwrite = _worker_state
+    parsed_type, output_path, _, template_name = work[index]
+    generator._generate_type(parsed_type, output_path, is_dryrun, allow_overwrite, template_name)
+
 
 # +---------------------------------------------------------------------------+
 # | JINJA : SupportGenerator
@@ -872,7 +1030,8 @@ class SupportGenerator(CodeGenerator):
             self._handle_overwrite(target, allow_overwrite)
             target.parent.mkdir(parents=True, exist_ok=True)
             if len(line_pps) == 0:
-                shutil.copy(str(resource), str(target))
+                if not target.exists() or not filecmp.cmp(str(resource), str(target), shallow=False):
+                    shutil.copy(str(resource), str(target))
             else:
                 self._copy_header_using_line_pps(resource, target, line_pps)
             for file_pp in file_pps:
@@ -885,14 +1044,15 @@ class SupportGenerator(CodeGenerator):
         target: pathlib.Path,
         line_pps: typing.List["nunavut.postprocessors.LinePostProcessor"],
     ) -> None:
-        with open(str(target), "w") as target_file:
-            with open(str(resource), "r") as resource_file:
-                for resource_line in resource_file:
-                    if len(resource_line) > 1 and resource_line[-2] == "\r":
-                        resource_line_tuple = (resource_line[0:-2], "\r\n")
-                    else:
-                        resource_line_tuple = (resource_line[0:-1], "\n")
-                    for line_pp in line_pps:
-                        resource_line_tuple = line_pp(resource_line_tuple)
-                    target_file.write(resource_line_tuple[0])
-                    target_file.write(resource_line_tuple[1])
+        target_contents = io.StringIO()
+        with open(str(resource), "r") as resource_file:
+            for resource_line in resource_file:
+                if len(resource_line) > 1 and resource_line[-2] == "\r":
+                    resource_line_tuple = (resource_line[0:-2], "\r\n")
+                else:
+                    resource_line_tuple = (resource_line[0:-1], "\n")
+                for line_pp in line_pps:
+                    resource_line_tuple = line_pp(resource_line_tuple)
+                target_contents.write(resource_line_tuple[0])
+                target_contents.write(resource_line_tuple[1])
+        self._write_if_changed(target, target_contents.getvalue())
@@ -4,16 +4,23 @@
 # This software is distributed under the terms of the MIT License.
 #
 import datetime
+import hashlib
 import inspect
+import json
 import logging
+import os
+import pathlib
 import types
 import typing
 
 import nunavut.lang
+import nunavut.version
+from nunavut._utilities import package_digest
 
 from ..templates import LanguageEnvironment
 from .extensions import JinjaAssert, UseQuery
 from .jinja2 import BaseLoader, Environment, StrictUndefined, select_autoescape
+from .jinja2.bccache import Bucket, FileSystemBytecodeCache
 from .jinja2.ext import Extension
 from .jinja2.ext import do as jinja_do
 from .jinja2.ext import loopcontrols as loopcontrols
@@ -108,6 +115,125 @@ class LanguageTemplateNamespace:
         return self.__dict__.values()
 
 
+# +---------------------------------------------------------------------------+
+# | JINJA : TemplateBytecodeCache
+# +---------------------------------------------------------------------------+
+
+
+def default_template_cache_dir() -> pathlib.Path:
+    """
+    The directory :class:`TemplateBytecodeCache` uses unless told otherwise: ``nunavut/templates`` under
+    ``$XDG_CACHE_HOME`` (or ``%LOCALAPPDATA%`` on Windows), falling back to ``~/.cache``.
+
+    .. invisible-code-block: python
+
+        from nunavut.jinja.environment import default_template_cache_dir
+        assert default_template_cache_dir().parts[-2:] == ('nunavut', 'templates')
+
+    """
+    cache_home = os.environ.get("XDG_CACHE_HOME") or os.environ.get("LOCALAPPDATA")
+    if cache_home:
+        cache_root = pathlib.Path(cache_home)
+    else:
+        cache_root = pathlib.Path.home() / ".cache"
+    return cache_root / "nunavut" / "templates"
+
+
+class TemplateBytecodeCache(FileSystemBytecodeCache):
+    """
+    Content-addressed Jinja bytecode cache shared by all processes using the same directory. Compiling templates is a
+    large part of the time nnvg takes for small namespaces so build systems that run nnvg once per namespace, or run
+    several at once, gain from skipping it.
+
+    The cache key is a digest of the template source, its name and file name, the environment settings that affect the
+    compiled code (delimiters, whitespace handling, extensions, and the names of all filters and tests) and a
+    configuration digest provided by the environment. The latter covers the version and sources of Nunavut and the
+    language configuration, since Jinja may evaluate filters with constant arguments at compile time. Entries are
+    therefore never stale, only unused, and may be deleted at any time.
+
+    .. invisible-code-block: python
+
+        import tempfile
+        import pathlib
+        from nunavut.jinja import CodeGenEnvironment
+        from nunavut.jinja.environment import TemplateBytecodeCache
+        from nunavut.jinja.jinja2 import DictLoader
+
+        with tempfile.TemporaryDirectory() as cache_dir:
+            def _env(template):
+                return CodeGenEnvironment(loader=DictLoader({'test': template}),
+                                          bytecode_cache_dir=pathlib.Path(cache_dir))
+
+            assert isinstance(_env('').bytecode_cache, TemplateBytecodeCache)
+            assert 'Hello World' == _env('Hello {{ "World" }}').get_template('test').render()
+            assert len(list(pathlib.Path(cache_dir).iterdir())) == 1
+
+            # The same template again is loaded from the cache. Another one gets its own entry.
+            assert 'Hello World' == _env('Hello {{ "World" }}').get_template('test').render()
+            assert 'Hello Moon' == _env('Hello {{ "Moon" }}').get_template('test').render()
+            assert len(list(pathlib.Path(cache_dir).iterdir())) == 2
+
+    :param pathlib.Path directory: Where to keep the cache. It is created if needed.
+    :param str configuration_digest: Digest of whatever else, beyond the environment settings, the compiled templates
+        depend upon.
+    """
+
+    def __init__(self, directory: pathlib.Path, configuration_digest: str):
+        directory.mkdir(mode=0o700, parents=True, exist_ok=True)
+        super().__init__(str(directory), "%s.nunavut-bytecode")
+        self._configuration_digest = configuration_digest
+
+    def get_bucket(self, environment: Environment, name: str, filename: typing.Optional[str], source: str) -> Bucket:
+        hasher = hashlib.sha256()
+        for part in (
+            self._configuration_digest,
+            self._environment_digest(environment),
+            name,
+            filename or "",
+            source,
+        ):
+            hasher.update(part.encode("utf-8"))
+            hasher.update(b"\0")
+        bucket = Bucket(environment, hasher.hexdigest(), self.get_source_checksum(source))
+        self.load_bytecode(bucket)
+        return bucket
+
+    def dump_bytecode(self, bucket: Bucket) -> None:
+        # Write to a file of our own and rename it into place so that concurrent nnvg processes never see partial
+        # entries. Failing to write the cache is not an error; the template was compiled anyway.
+        target = self._get_cache_filename(bucket)
+        temporary = "{}.{}.tmp".format(target, os.getpid())
+        try:
+            with open(temporary, "wb") as f:
+                bucket.write_bytecode(f)
+            os.replace(temporary, target)
+        except OSError as e:
+            logger.debug("Could not write template bytecode cache entry %s: %s", target, e)
+
+    @staticmethod
+    def _environment_digest(environment: Environment) -> str:
+        return json.dumps(
+            [
+                [
+                    environment.block_start_string,
+                    environment.block_end_string,
+                    environment.variable_start_string,
+                    environment.variable_end_string,
+                    environment.comment_start_string,
+                    environment.comment_end_string,
+                    environment.line_statement_prefix,
+                    environment.line_comment_prefix,
+                    environment.newline_sequence,
+                ],
+                [environment.trim_blocks, environment.lstrip_blocks, environment.keep_trailing_newline],
+                [environment.optimized, environment.autoescape is not False],
+                sorted(environment.extensions.keys()),
+                sorted(environment.filters.keys()),
+                sorted(environment.tests.keys()),
+            ]
+        )
+
+
 # +---------------------------------------------------------------------------+
 # | JINJA : CodeGenEnvironment
 # +---------------------------------------------------------------------------+
@@ -205,6 +331,7 @@ class CodeGenEnvironment(Environment):
         additional_globals: typing.Optional[typing.Dict[str, typing.Any]] = None,
         extensions: typing.List[Extension] = [jinja_do, loopcontrols, JinjaAssert, UseQuery],
         allow_filter_test_or_use_query_overwrite: bool = False,
+        bytecode_cache_dir: typing.Optional[pathlib.Path] = None,
     ):
         super().__init__(
             loader=loader,  # nosec
@@ -258,6 +385,12 @@ class CodeGenEnvironment(Environment):
         if additional_tests is not None:
             self._add_each_to_environment(additional_tests.items(), self.tests, supported_languages=supported_languages)
 
+        if bytecode_cache_dir is not None:
+            try:
+                self.bytecode_cache = TemplateBytecodeCache(bytecode_cache_dir, self._create_configuration_digest(lctx))
+            except OSError as e:
+                logger.warning("Template bytecode cache disabled; cannot use %s: %s", bytecode_cache_dir, e)
+
     def add_conventional_methods_to_environment(self, obj: typing.Any) -> None:
         for name, method in inspect.getmembers(obj, inspect.isroutine):
             try:
@@ -419,6 +552,21 @@ class CodeGenEnvironment(Environment):
                 method, method_name, collection, supported_languages, language, is_target
             )
 
+    @staticmethod
+    def _create_configuration_digest(lctx: typing.Optional[nunavut.lang.LanguageContext]) -> str:
+        """
+        Digest of the inputs, other than the environment settings, that the compiled templates may depend upon. See
+        :class:`TemplateBytecodeCache`.
+        """
+        configuration = [nunavut.version.__version__, package_digest()]  # type: typing.List[typing.Any]
+        if lctx is not None:
+            configuration.append(lctx.config.sections())
+            target_language = lctx.get_target_language()
+            if target_language is not None:
+                configuration.append([target_language.name, target_language.get_options()])
+                configuration.append(target_language.omit_serialization_support)
+        return hashlib.sha256(json.dumps(configuration, sort_keys=True, default=str).encode("utf-8")).hexdigest()
+
     @classmethod
     def _create_platform_version(cls) -> typing.Dict[str, typing.Any]:
         import platform
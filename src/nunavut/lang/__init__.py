@@ -276,6 +276,20 @@ class Language(metaclass=abc.ABCMeta):
         """
         pass
 
+    def get_implementation_outputs(
+        self, for_type: pydsdl.CompositeType, output_path: pathlib.Path
+    ) -> typing.List[typing.Tuple[str, pathlib.Path]]:
+        """
+        Files generated for a type in addition to the one at ``output_path``, like C++ source files holding
+        definitions taken out of the header.
+
+        :param pydsdl.CompositeType for_type: The type being generated.
+        :param pathlib.Path output_path: The path of the main output file for the type.
+        :return: The template name and output path of each additional file. Empty unless the language overrides
+            this method.
+        """
+        return []
+
     def filter_id(self, instance: typing.Any, id_type: str = "any") -> str:
         """
         Produces a valid identifier in the language for a given object. The encoding may not be reversible.
@@ -35,9 +35,12 @@ class IncludeGenerator:
         for namespace_part in self._language.support_namespace:
             namespace_path = namespace_path / pathlib.Path(namespace_part)
         if not self._language.omit_serialization_support:
+            # Types only need the core serialization header. The other support headers (e.g. the C++ port dispatch
+            # tables or the batch decoder) are included by the code that uses them.
             path_list += [
                 (namespace_path / pathlib.Path(p.name).with_suffix(output_extension)).as_posix()
                 for p in self._language.get_support_files(ResourceType.SERIALIZATION_SUPPORT)
+                if p.stem == "serialization"
             ]
 
         prefer_system_includes = self._language.get_config_value_as_bool("prefer_system_includes", False)
@@ -8,6 +8,7 @@
     module will be available in the template's global namespace as ``cpp``.
 """
 
+import fnmatch
 import fractions
 import functools
 import io
@@ -25,6 +26,7 @@ from .. import Language as BaseLanguage
 from .._common import IncludeGenerator, TokenEncoder, UniqueNameGenerator
 from ..c import _CFit
 from ..c import filter_literal as c_filter_literal
+from ..c import is_zero_cost_primitive as c_is_zero_cost_primitive
 
 
 class Language(BaseLanguage):
@@ -153,12 +155,46 @@ class Language(BaseLanguage):
         template_w_namespace = lctx.get_target_language()._get_default_vla_template()
         assert template_w_namespace.startswith("foo::bar::VariableLengthArray")
 
+        With allocator support enabled the arrays draw from a (possibly unbound) arena:
+
+        config_w_allocator = {
+                    'nunavut.lang.cpp':
+                    {
+                        'support_namesapce': 'foo.bar',
+                        'options': {'enable_allocator_support': True}
+                    }
+                }
+
+        lctx = configurable_language_context_factory(config_w_allocator, 'cpp')
+        template_w_allocator = lctx.get_target_language()._get_default_vla_template()
+        assert template_w_allocator.endswith(", foo::bar::MonotonicArenaAllocator<{TYPE}>>")
+
+        With an inline storage threshold small arrays are chosen at compile time by the size of their elements:
+
+        config_w_inline = {
+                    'nunavut.lang.cpp':
+                    {
+                        'support_namesapce': 'foo.bar',
+                        'options': {'variable_array_inline_below_bytes': 32}
+                    }
+                }
+
+        lctx = configurable_language_context_factory(config_w_inline, 'cpp')
+        template_w_inline = lctx.get_target_language()._get_default_vla_template()
+        assert template_w_inline == "foo::bar::SmallVariableLengthArray<{TYPE}, {MAX_SIZE}, 32>"
+
         """
-        base_template = "VariableLengthArray<{TYPE}, {MAX_SIZE}>"
-        if len(self.support_namespace) > 0:
-            return "::".join(self.support_namespace) + "::" + base_template
+        namespace_prefix = ("::".join(self.support_namespace) + "::") if len(self.support_namespace) > 0 else ""
+        inline_below_bytes = self.get_option("variable_array_inline_below_bytes")
+        if isinstance(inline_below_bytes, int) and inline_below_bytes > 0:
+            container = "{ns}SmallVariableLengthArray<{{TYPE}}, {{MAX_SIZE}}, {bytes}".format(
+                ns=namespace_prefix, bytes=inline_below_bytes
+            )
         else:
-            return base_template
+            container = "{ns}VariableLengthArray<{{TYPE}}, {{MAX_SIZE}}".format(ns=namespace_prefix)
+        if self.get_option("enable_allocator_support"):
+            return container + ", {ns}MonotonicArenaAllocator<{{TYPE}}>>".format(ns=namespace_prefix)
+        return container + ">"
 
     def get_includes(self, dep_types: Dependencies) -> typing.List[str]:
         """
@@ -223,7 +259,11 @@ class Language(BaseLanguage):
             std_includes.append("variant")
         includes_formatted = ["<{}>".format(include) for include in sorted(std_includes)]
 
-        if dep_types.uses_variable_length_array:
+        # The arena types generated deserialize overloads refer to live in the built-in VLA header.
+        uses_allocator_support = bool(self.get_option("enable_allocator_support")) and not self.get_option(
+            "variable_array_type_template"
+        )
+        if dep_types.uses_variable_length_array or uses_allocator_support:
             vla_include = None  # type: typing.Optional[str]
             variable_array_include = self.get_config_value("variable_array_type_include", "")
             if variable_array_include != "":
@@ -237,6 +277,41 @@ class Language(BaseLanguage):
 
         return includes_formatted
 
+    def get_implementation_outputs(
+        self, for_type: pydsdl.CompositeType, output_path: pathlib.Path
+    ) -> typing.List[typing.Tuple[str, pathlib.Path]]:
+        """
+        With ``enable_out_of_line_serialization`` a source file holding the serialization functions is generated next
+        to the header of each type serialized out of line.
+
+        .. invisible-code-block: python
+
+            import pathlib
+            from unittest.mock import MagicMock
+            import pydsdl
+
+            def _outputs(options):
+                lctx = configurable_language_context_factory({'nunavut.lang.cpp': {'options': options}}, 'cpp')
+                my_type = MagicMock(spec=pydsdl.StructureType)
+                my_type.full_name = 'uavcan.node.Heartbeat'
+                my_type.has_parent_service = False
+                return lctx.get_target_language().get_implementation_outputs(my_type, pathlib.Path('Heartbeat_1_0.hpp'))
+
+            assert _outputs({}) == []
+            assert _outputs({'enable_out_of_line_serialization': True}) == [
+                ('Implementation.j2', pathlib.Path('Heartbeat_1_0.cpp'))
+            ]
+            assert _outputs({'enable_out_of_line_serialization': True, 'inline_serialization_types': 'uavcan.*'}) == []
+
+        """
+        if isinstance(for_type, pydsdl.ServiceType):
+            types = [for_type.request_type, for_type.response_type]
+        else:
+            types = [for_type]
+        if any(is_serialized_out_of_line(self, t) for t in types):
+            return [("Implementation.j2", output_path.with_suffix(self.get_config_value("implementation_extension")))]
+        return []
+
     def filter_id(self, instance: typing.Any, id_type: str = "any") -> str:
         raw_name = self.default_filter_id_for_target(instance)
 
@@ -294,6 +369,292 @@ def uses_std_variant(language: Language) -> bool:
     return language._has_variant()
 
 
+@template_language_test(__name__)
+def is_zero_cost_primitive(language: Language, t: pydsdl.PrimitiveType) -> bool:
+    """
+    Detects whether the native in-memory representation of a value of the supplied primitive type is the same as its
+    on-the-wire representation. See :func:`nunavut.lang.c.is_zero_cost_primitive` for details; arrays of such types
+    are serialized with a single bit copy.
+
+    .. invisible-code-block: python
+
+        from nunavut.lang.cpp import is_zero_cost_primitive
+        import pydsdl
+
+    .. code-block:: python
+
+        # Given
+        u8  = pydsdl.UnsignedIntegerType(8, pydsdl.PrimitiveType.CastMode.TRUNCATED)
+        f16 = pydsdl.FloatType(16, pydsdl.PrimitiveType.CastMode.TRUNCATED)
+
+        # and
+        template = '{{ u8 is zero_cost_primitive }} {{ f16 is zero_cost_primitive }}'
+
+        # then, on a little-endian target
+        rendered = 'True False'
+
+    .. invisible-code-block: python
+
+        config_overrides = {'nunavut.lang.cpp': {'options': {'target_endianness': 'little' }}}
+        lctx = configurable_language_context_factory(config_overrides, 'cpp')
+        jinja_filter_tester(is_zero_cost_primitive, template, rendered, lctx, u8=u8, f16=f16)
+
+    """
+    return c_is_zero_cost_primitive(language, t)
+
+
+@template_language_test(__name__)
+def is_serialized_out_of_line(language: Language, t: pydsdl.CompositeType) -> bool:
+    """
+    Detects whether the serialization functions of a type are defined in a generated source file rather than in its
+    header. This is the case for all types when ``enable_out_of_line_serialization`` is set, except those matching
+    any of the whitespace or comma separated ``fnmatch`` patterns in ``inline_serialization_types``. The patterns are
+    matched against the full name of the type, with and without its version, or of its service for requests and
+    responses.
+
+    .. invisible-code-block: python
+
+        from nunavut.lang.cpp import is_serialized_out_of_line
+        from unittest.mock import MagicMock
+        import pydsdl
+
+    .. code-block:: python
+
+        # Given
+        heartbeat = MagicMock(spec=pydsdl.StructureType)
+        heartbeat.full_name = 'uavcan.node.Heartbeat'
+        heartbeat.has_parent_service = False
+        heartbeat.version = pydsdl.Version(1, 0)
+
+        # and
+        template = '{{ heartbeat is serialized_out_of_line }}'
+
+        # then, with out-of-line serialization enabled
+        rendered = 'True'
+
+    .. invisible-code-block: python
+
+        def _lctx(options):
+            return configurable_language_context_factory({'nunavut.lang.cpp': {'options': options}}, 'cpp')
+
+        jinja_filter_tester(is_serialized_out_of_line, template, 'False', _lctx({}), heartbeat=heartbeat)
+        jinja_filter_tester(is_serialized_out_of_line, template, rendered,
+                            _lctx({'enable_out_of_line_serialization': True}), heartbeat=heartbeat)
+        for patterns in ('uavcan.node.Heartbeat', 'uavcan.node.Heartbeat.1.0', 'foo.Bar, uavcan.node.*'):
+            jinja_filter_tester(is_serialized_out_of_line, template, 'False',
+                                _lctx({'enable_out_of_line_serialization': True,
+                                       'inline_serialization_types': patterns}),
+                                heartbeat=heartbeat)
+
+    """
+    if language.omit_serialization_support or not language.get_option("enable_out_of_line_serialization"):
+        return False
+    return not _matches_type_patterns(t, language.get_option("inline_serialization_types", ""))
+
+
+def _matches_type_patterns(t: pydsdl.CompositeType, patterns: typing.Any) -> bool:
+    """
+    True if the type matches any of the whitespace or comma separated ``fnmatch`` patterns given as the value of a
+    language option.
+    """
+    # The request and response types of a service are named after the service with ".Request" or ".Response".
+    full_name = str(t.full_name).rsplit(".", 1)[0] if t.has_parent_service else str(t.full_name)
+    names = (full_name, "{}.{}.{}".format(full_name, t.version.major, t.version.minor))
+    return any(
+        fnmatch.fnmatchcase(name, pattern)
+        for pattern in re.split(r"[\s,]+", str(patterns or "").strip())
+        if pattern
+        for name in names
+    )
+
+
+@template_language_test(__name__)
+def is_table_serialized(language: Language, t: pydsdl.CompositeType) -> bool:
+    """
+    Detects whether a type is serialized by the interpreter of ``nunavut/support/table_serialization.hpp`` walking a
+    table of its fields, rather than by code unrolled for each field. This is the case for the types matching any of
+    the whitespace or comma separated ``fnmatch`` patterns in ``table_serialization_types``, which are matched like
+    those of ``inline_serialization_types``, with a few exceptions that keep the unrolled code:
+
+    - unions, whose alternatives are not at fixed offsets in the object;
+    - types that serialize to nothing;
+    - all types when the containers of variable-length arrays are not the built-in ``VariableLengthArray``, which
+      is the case with ``variable_array_type_template``, ``variable_array_inline_below_bytes`` or
+      ``enable_allocator_support``, or when their capacity can be overridden;
+    - types holding a ``std::variant``, which is not guaranteed to be a standard-layout type that fields can be
+      located in with ``offsetof``.
+
+    .. invisible-code-block: python
+
+        from nunavut.lang.cpp import is_table_serialized
+        from unittest.mock import MagicMock
+        import pydsdl
+
+    .. code-block:: python
+
+        # Given
+        u8 = pydsdl.UnsignedIntegerType(8, pydsdl.PrimitiveType.CastMode.TRUNCATED)
+        heartbeat = MagicMock(spec=pydsdl.StructureType)
+        heartbeat.full_name = 'uavcan.node.Heartbeat'
+        heartbeat.has_parent_service = False
+        heartbeat.version = pydsdl.Version(1, 0)
+        heartbeat.inner_type = heartbeat
+        heartbeat.bit_length_set.max = 56
+        heartbeat.fields = [pydsdl.Field(u8, 'mode')]
+
+        # and
+        template = '{{ heartbeat is table_serialized }}'
+
+        # then, with table_serialization_types set to 'uavcan.node.*'
+        rendered = 'True'
+
+    .. invisible-code-block: python
+
+        def _lctx(options):
+            return configurable_language_context_factory({'nunavut.lang.cpp': {'options': options}}, 'cpp')
+
+        jinja_filter_tester(is_table_serialized, template, 'False', _lctx({}), heartbeat=heartbeat)
+        for patterns in ('uavcan.node.*', 'uavcan.node.Heartbeat.1.0', 'foo.Bar, uavcan.*'):
+            jinja_filter_tester(is_table_serialized, template, rendered,
+                                _lctx({'table_serialization_types': patterns}), heartbeat=heartbeat)
+        jinja_filter_tester(is_table_serialized, template, 'False',
+                            _lctx({'table_serialization_types': 'uavcan.node.*', 'enable_allocator_support': True}),
+                            heartbeat=heartbeat)
+
+    """
+    if language.omit_serialization_support or not _matches_type_patterns(
+        t, language.get_option("table_serialization_types", "")
+    ):
+        return False
+    if (
+        language.get_option("variable_array_type_template")
+        or language.get_option("variable_array_inline_below_bytes")
+        or language.get_option("enable_allocator_support")
+        or language.get_option("enable_override_variable_array_capacity")
+    ):
+        return False
+    if not isinstance(t.inner_type, pydsdl.StructureType) or t.inner_type.bit_length_set.max == 0:
+        return False
+
+    def _holds_union(data_type: pydsdl.SerializableType) -> bool:
+        if isinstance(data_type, pydsdl.ArrayType):
+            return _holds_union(data_type.element_type)
+        if isinstance(data_type, pydsdl.CompositeType):
+            return isinstance(data_type.inner_type, pydsdl.UnionType) or any(
+                _holds_union(field.data_type) for field in data_type.inner_type.fields
+            )
+        return False
+
+    return not (uses_std_variant(language) and _holds_union(t))
+
+
+@template_language_test(__name__)
+def is_unchecked_serializable(language: Language, t: pydsdl.CompositeType) -> bool:
+    """
+    Detects whether a composite type gets a ``serialize_into_unchecked()`` member function. Types nesting it call that
+    function instead of ``serialize()`` once they have checked that their buffer holds the nested object, which
+    saves creating a subspan and checking the capacity and the result again at every level. This requires that the
+    serialization of the type cannot fail given enough room, i.e. that its fields, or those of the type it is the
+    delimited view of, are of fixed length. Serialization tracing reports each nested object itself, so it turns
+    this off, as do ``enable_override_variable_array_capacity`` and disabling
+    ``enable_unchecked_fixed_length_serialization``. Table-driven types (see :func:`is_table_serialized`) do without
+    it too, since it would be unrolled code of their own.
+
+    .. invisible-code-block: python
+
+        from nunavut.lang.cpp import is_unchecked_serializable
+        from unittest.mock import MagicMock
+        import pydsdl
+
+    .. code-block:: python
+
+        # Given
+        fixed = MagicMock(spec=pydsdl.StructureType)
+        fixed.inner_type.bit_length_set.fixed_length = True
+        variable = MagicMock(spec=pydsdl.StructureType)
+        variable.inner_type.bit_length_set.fixed_length = False
+
+        # and
+        template = '{{ fixed is unchecked_serializable }} {{ variable is unchecked_serializable }}'
+
+        # then
+        rendered = 'True False'
+
+    .. invisible-code-block: python
+
+        def _lctx(options):
+            return configurable_language_context_factory({'nunavut.lang.cpp': {'options': options}}, 'cpp')
+
+        jinja_filter_tester(is_unchecked_serializable, template, rendered, _lctx({}), fixed=fixed, variable=variable)
+        jinja_filter_tester(is_unchecked_serializable, template, 'False False',
+                            _lctx({'enable_serialization_tracing': True}), fixed=fixed, variable=variable)
+
+    """
+    return (
+        not language.omit_serialization_support
+        and bool(language.get_option("enable_unchecked_fixed_length_serialization"))
+        and not language.get_option("enable_override_variable_array_capacity")
+        and not language.get_option("enable_serialization_tracing")
+        and bool(t.inner_type.bit_length_set.fixed_length)
+        and not is_table_serialized(language, t)
+    )
+
+
+@template_language_test(__name__)
+def is_constexpr_serializable(language: Language, t: pydsdl.SerializableType) -> bool:
+    """
+    Detects whether values of the supplied type can be serialized in constant expressions. This requires C++17 or
+    newer and no variable-length arrays anywhere in the type, since the containers used for these cannot be
+    constructed at compile time. Nor may the type, or any type within it, be serialized out of line (see
+    :func:`is_serialized_out_of_line`) or by the table interpreter (see :func:`is_table_serialized`). The support library decides whether the compiler is able to do it; see
+    ``NUNAVUT_SUPPORT_CONSTEXPR_SERIALIZATION``.
+
+    .. invisible-code-block: python
+
+        from nunavut.lang.cpp import is_constexpr_serializable
+        import pydsdl
+
+    .. code-block:: python
+
+        # Given
+        u8 = pydsdl.UnsignedIntegerType(8, pydsdl.PrimitiveType.CastMode.TRUNCATED)
+        fixed = pydsdl.FixedLengthArrayType(u8, 4)
+        variable = pydsdl.VariableLengthArrayType(u8, 4)
+
+        # and
+        template = '{{ fixed is constexpr_serializable }} {{ variable is constexpr_serializable }}'
+
+        # then, for C++17
+        rendered = 'True False'
+
+    .. invisible-code-block: python
+
+        config_overrides = {'nunavut.lang.cpp': {'options': {'std': 'c++17' }}}
+        lctx = configurable_language_context_factory(config_overrides, 'cpp')
+        jinja_filter_tester(is_constexpr_serializable, template, rendered, lctx, fixed=fixed, variable=variable)
+
+        config_overrides = {'nunavut.lang.cpp': {'options': {'std': 'c++14' }}}
+        lctx = configurable_language_context_factory(config_overrides, 'cpp')
+        jinja_filter_tester(is_constexpr_serializable, template, 'False False', lctx, fixed=fixed, variable=variable)
+
+    """
+    if language._standard_version() < 17:
+        return False
+
+    def _is_constexpr(data_type: pydsdl.SerializableType) -> bool:
+        if isinstance(data_type, pydsdl.VariableLengthArrayType):
+            return False
+        if isinstance(data_type, pydsdl.ArrayType):
+            return _is_constexpr(data_type.element_type)
+        if isinstance(data_type, pydsdl.CompositeType):
+            if is_serialized_out_of_line(language, data_type) or is_table_serialized(language, data_type):
+                return False
+            return all(_is_constexpr(field.data_type) for field in data_type.inner_type.fields)
+        return True
+
+    return _is_constexpr(t)
+
+
 @template_language_filter(__name__)
 def filter_constant_value(language: Language, constant: pydsdl.Constant) -> str:
     """
@@ -1400,6 +1761,70 @@ def filter_minimum_required_capacity_bits(t: pydsdl.SerializableType) -> int:
     return typing.cast(int, min(t.bit_length_set))
 
 
+def filter_port_dispatch_types(namespace: typing.Any, kind: str = "message") -> typing.List[pydsdl.CompositeType]:
+    """
+    Lists the types with a fixed port-ID in a :class:`nunavut.Namespace` and in all namespaces nested in it, sorted
+    by port-ID. These are the entries of the port dispatch tables in the C++ namespace headers. Where several minor
+    versions of a type share a port-ID only the newest is listed.
+
+    .. invisible-code-block: python
+
+        from nunavut.lang.cpp import filter_port_dispatch_types
+        from unittest.mock import MagicMock
+        import pydsdl
+
+        def _make_type(spec, name, port_id, minor=0):
+            t = MagicMock(spec=spec)
+            t.full_name = name
+            t.has_fixed_port_id = port_id is not None
+            t.fixed_port_id = port_id
+            t.version = pydsdl.Version(1, minor)
+            return t
+
+        namespace = MagicMock()
+        namespace.get_all_datatypes.return_value = [
+            (_make_type(pydsdl.StructureType, 'uavcan.node.Heartbeat', 7509, 0), None),
+            (_make_type(pydsdl.StructureType, 'uavcan.node.Heartbeat', 7509, 1), None),
+            (_make_type(pydsdl.StructureType, 'uavcan.node.Health', None), None),
+            (_make_type(pydsdl.StructureType, 'uavcan.time.Synchronization', 7168), None),
+            (_make_type(pydsdl.ServiceType, 'uavcan.node.GetInfo', 430), None),
+        ]
+
+    .. code-block:: python
+
+        # Given the namespace uavcan, then
+        template = '''{% for t in namespace | port_dispatch_types %}
+        {{ t.full_name }}.{{ t.version.minor }}: {{ t.fixed_port_id }}
+        {%- endfor %}
+        {% for t in namespace | port_dispatch_types('service') %}
+        {{ t.full_name }}: {{ t.fixed_port_id }}
+        {%- endfor %}'''
+
+        # gives
+        rendered = '''
+        uavcan.time.Synchronization.0: 7168
+        uavcan.node.Heartbeat.1: 7509
+
+        uavcan.node.GetInfo: 430'''
+
+    .. invisible-code-block: python
+
+        jinja_filter_tester(filter_port_dispatch_types, template, rendered, 'cpp', namespace=namespace)
+
+    :param nunavut.Namespace namespace: The namespace to list the types of.
+    :param str kind: ``message`` for message types or ``service`` for service types.
+    :return: The types, sorted by fixed port-ID.
+    """
+    newest = dict()  # type: typing.Dict[int, pydsdl.CompositeType]
+    for t, _ in namespace.get_all_datatypes():
+        if not t.has_fixed_port_id or isinstance(t, pydsdl.ServiceType) != (kind == "service"):
+            continue
+        current = newest.get(t.fixed_port_id)
+        if current is None or t.version > current.version:
+            newest[t.fixed_port_id] = t
+    return [newest[port_id] for port_id in sorted(newest)]
+
+
 @functools.lru_cache(3)
 def _make_textwrap(width: int, initial_indent: str, subseqent_indent: str) -> textwrap.TextWrapper:
     return textwrap.TextWrapper(
@@ -8,13 +8,16 @@
 #ifndef NUNAVUT_SUPPORT_VARIABLE_LENGTH_ARRAY_HPP_INCLUDED
 #define NUNAVUT_SUPPORT_VARIABLE_LENGTH_ARRAY_HPP_INCLUDED
 
+#include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <cstring>
 #include <type_traits>
 #include <memory>
 #include <utility>
 #include <initializer_list>
+#include <limits>
 #if __cpp_exceptions
 #    include <stdexcept>
 #endif
@@ -47,6 +50,162 @@ public:
     }
 };
 
+///
+/// Bump-pointer memory region that hands out storage for a graph of objects and gives it back all at once.
+/// Individual deallocations are ignored; call release() to reclaim the whole region in O(1). The arena does not
+/// own the memory it manages (see FixedBufferArena for a variant that does) and must outlive every object
+/// allocated from it.
+///
+class MonotonicArena
+{
+public:
+    MonotonicArena(void* buffer, std::size_t size_bytes) noexcept
+        : begin_(static_cast<unsigned char*>(buffer))
+        , capacity_(size_bytes)
+        , used_(0)
+    {
+    }
+
+    MonotonicArena(const MonotonicArena&)            = delete;
+    MonotonicArena& operator=(const MonotonicArena&) = delete;
+    MonotonicArena(MonotonicArena&&)                 = delete;
+    MonotonicArena& operator=(MonotonicArena&&)      = delete;
+
+    ///
+    /// Allocate @p size_bytes aligned to @p alignment, which must be a power of two.
+    /// @return A pointer into the region or nullptr if the region is exhausted.
+    ///
+    void* allocate(std::size_t size_bytes, std::size_t alignment) noexcept
+    {
+        const std::uintptr_t cursor  = reinterpret_cast<std::uintptr_t>(begin_) + used_;
+        const std::size_t    padding = static_cast<std::size_t>((alignment - (cursor & (alignment - 1U))) &
+                                                             (alignment - 1U));
+        const std::size_t    remaining = capacity_ - used_;
+        if (padding > remaining || size_bytes > (remaining - padding))
+        {
+            return nullptr;
+        }
+        void* const result = begin_ + used_ + padding;
+        used_ += padding + size_bytes;
+        return result;
+    }
+
+    ///
+    /// Return every allocation to the region at once. Objects allocated from the arena must not be used, or
+    /// destroyed with a non-trivial destructor, after this call.
+    ///
+    void release() noexcept
+    {
+        used_ = 0;
+    }
+
+    std::size_t used() const noexcept
+    {
+        return used_;
+    }
+
+    std::size_t capacity() const noexcept
+    {
+        return capacity_;
+    }
+
+private:
+    unsigned char* const begin_;
+    const std::size_t    capacity_;
+    std::size_t          used_;
+};
+
+///
+/// A MonotonicArena carrying its own fixed-size, suitably aligned backing storage. Usable as a static or stack
+/// allocated pool for a whole message tree.
+///
+/// @tparam  SizeBytes   The size of the pool in bytes.
+///
+template <std::size_t SizeBytes>
+class FixedBufferArena final : public MonotonicArena
+{
+public:
+    FixedBufferArena() noexcept
+        : MonotonicArena(storage_, SizeBytes)
+    {
+    }
+
+private:
+    alignas(std::max_align_t) unsigned char storage_[SizeBytes];
+};
+
+///
+/// Stateful allocator drawing from a MonotonicArena. A default-constructed allocator is not bound to any arena
+/// and falls back to malloc and free so containers using it behave like they would with MallocAllocator until
+/// they are given an arena. Allocations fail (return nullptr) once the arena is exhausted.
+///
+template <typename T>
+class MonotonicArenaAllocator
+{
+public:
+    using value_type = T;
+
+    MonotonicArenaAllocator() noexcept
+        : arena_(nullptr)
+    {
+    }
+
+    explicit MonotonicArenaAllocator(MonotonicArena* arena) noexcept
+        : arena_(arena)
+    {
+    }
+
+    explicit MonotonicArenaAllocator(MonotonicArena& arena) noexcept
+        : arena_(&arena)
+    {
+    }
+
+    template <typename U>
+    MonotonicArenaAllocator(const MonotonicArenaAllocator<U>& rhs) noexcept
+        : arena_(rhs.arena())
+    {
+    }
+
+    T* allocate(std::size_t n) noexcept
+    {
+        if (nullptr == arena_)
+        {
+            return reinterpret_cast<T*>(malloc(n * sizeof(T)));
+        }
+        return static_cast<T*>(arena_->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* p, std::size_t n) noexcept
+    {
+        (void) n;
+        if (nullptr == arena_)
+        {
+            free(p);
+        }
+        // else the memory is reclaimed by MonotonicArena::release().
+    }
+
+    MonotonicArena* arena() const noexcept
+    {
+        return arena_;
+    }
+
+private:
+    MonotonicArena* arena_;
+};
+
+template <typename T, typename U>
+bool operator==(const MonotonicArenaAllocator<T>& lhs, const MonotonicArenaAllocator<U>& rhs) noexcept
+{
+    return lhs.arena() == rhs.arena();
+}
+
+template <typename T, typename U>
+bool operator!=(const MonotonicArenaAllocator<T>& lhs, const MonotonicArenaAllocator<U>& rhs) noexcept
+{
+    return lhs.arena() != rhs.arena();
+}
+
 ///
 /// Minimal, generic container for storing UAVCAN variable-length arrays. One property that is unique
 /// for variable-length arrays is that they have a maximum bound which this implementation enforces.
@@ -68,6 +227,15 @@ public:
     {
     }
 
+    explicit VariableLengthArray(const Allocator& alloc) noexcept(
+        std::is_nothrow_copy_constructible<Allocator>::value)
+        : data_(nullptr)
+        , capacity_(0)
+        , size_(0)
+        , alloc_(alloc)
+    {
+    }
+
     VariableLengthArray(std::initializer_list<T> l) noexcept(
         noexcept(VariableLengthArray<T, MaxSize, Allocator>().reserve(1)) &&
         std::is_nothrow_constructible<Allocator>::value && std::is_nothrow_copy_constructible<T>::value)
@@ -254,6 +422,19 @@ public:
     ///
     static constexpr const std::size_t type_max_size = MaxSize;
 
+    ///
+    /// False for this container; see InlineVariableLengthArray.
+    ///
+    static constexpr const bool has_inline_storage = false;
+
+    ///
+    /// The elements live outside of the array, so moving the array's bytes moves the elements as well, given that
+    /// the allocator holds no state of its own besides, at most, a pointer to an arena. See
+    /// nunavut::support::is_trivially_relocatable in the serialization support header.
+    ///
+    static constexpr const bool IsTriviallyRelocatable =
+        std::is_empty<Allocator>::value || std::is_same<Allocator, MonotonicArenaAllocator<T>>::value;
+
     ///
     /// The maximum size (and capacity) of this array. This method is compatible
     /// with {@code stl::vector::max_size} and always returns {@code type_max_size}.
@@ -630,6 +811,64 @@ public:
         }
     }
 
+    ///
+    /// Change the number of elements in the array to {@code new_size} with a single capacity check and at most one
+    /// allocation. Growing value-initializes the new elements unless T is trivially default constructible and
+    /// trivially copyable, in which case they are left uninitialized for the caller to overwrite (this is what
+    /// deserializers do). Shrinking destroys the elements past {@code new_size}.
+    ///
+    /// If exceptions are disabled the caller must compare the returned size to {@code new_size} to determine success.
+    /// On failure the array is left unchanged.
+    ///
+    /// @param  new_size The number of elements the array shall contain.
+    /// @return The size of the array after the call.
+    /// @throw std::length_error if new_size is greater than max_size.
+    /// @throw std::bad_alloc if memory was needed and none could be allocated.
+    ///
+    std::size_t resize_for_overwrite(const std::size_t new_size)
+    {
+        while (size_ > new_size)
+        {
+            pop_back();
+        }
+        if ((size_ < new_size) && ensure_capacity(new_size))
+        {
+            construct_for_overwrite<T>(data_, size_, new_size);
+            size_ = new_size;
+        }
+        return size_;
+    }
+
+    ///
+    /// Copy {@code count} elements from {@code src} to the back of the array with a single capacity check and at
+    /// most one allocation. Trivially copyable elements are copied with memcpy().
+    ///
+    /// If exceptions are disabled the caller must check the returned value to determine success. On failure
+    /// nothing is appended.
+    ///
+    /// @param  src   The elements to copy. Shall not point into this array.
+    /// @param  count The number of elements to copy.
+    /// @return The number of elements appended; either {@code count} or 0.
+    /// @throw std::length_error if the resulting size would be greater than max_size.
+    /// @throw std::bad_alloc if memory was needed and none could be allocated.
+    ///
+    std::size_t append(const T* const src, const std::size_t count)
+    {
+        if ((count == 0) || (count > (MaxSize - size_)) || !ensure_capacity(size_ + count))
+        {
+#if __cpp_exceptions
+            if (count > (MaxSize - size_))
+            {
+                throw std::length_error("Cannot append more elements than max size.");
+            }
+#endif
+            return 0;
+        }
+        copy_construct_n<T>(&data_[size_], src, count);
+        size_ += count;
+        return count;
+    }
+
     ///
     /// Remove and destroy the last item in the array. This reduces the array size by 1 unless
     /// the array is already empty.
@@ -694,6 +933,97 @@ private:
 
     }
 
+    /**
+     * Ensure the capacity is at least {@code desired_capacity} with at most one allocation.
+     */
+    bool ensure_capacity(const std::size_t desired_capacity)
+    {
+        if (desired_capacity <= capacity_)
+        {
+            return true;
+        }
+
+        if (desired_capacity > MaxSize)
+        {
+#if __cpp_exceptions
+            throw std::length_error("Requested size exceeds max size.");
+#endif
+            return false;
+        }
+
+        if (reserve(desired_capacity) < desired_capacity)
+        {
+#if __cpp_exceptions
+            throw std::bad_alloc();
+#endif
+            return false;
+        }
+        return true;
+    }
+
+    ///
+    /// Elements that are trivial to construct and to copy are left uninitialized by resize_for_overwrite.
+    ///
+    template <typename U>
+    static void construct_for_overwrite(
+        U* const          data,
+        const std::size_t begin,
+        const std::size_t end,
+        typename std::enable_if<std::is_trivially_default_constructible<U>::value &&
+                                std::is_trivially_copyable<U>::value>::type* = 0) noexcept
+    {
+        (void) data;
+        (void) begin;
+        (void) end;
+    }
+
+    ///
+    /// Any other elements are value-initialized.
+    ///
+    template <typename U>
+    static void construct_for_overwrite(
+        U* const          data,
+        const std::size_t begin,
+        const std::size_t end,
+        typename std::enable_if<!(std::is_trivially_default_constructible<U>::value &&
+                                  std::is_trivially_copyable<U>::value)>::type* =
+            0) noexcept(std::is_nothrow_default_constructible<U>::value)
+    {
+        for (std::size_t i = begin; i < end; ++i)
+        {
+            new (&data[i]) U();
+        }
+    }
+
+    ///
+    /// Trivially copyable elements are copied as raw memory.
+    ///
+    template <typename U>
+    static void copy_construct_n(U* const          dst,
+                                 const U* const    src,
+                                 const std::size_t count,
+                                 typename std::enable_if<std::is_trivially_copyable<U>::value>::type* = 0) noexcept
+    {
+        std::memcpy(dst, src, count * sizeof(U));
+    }
+
+    ///
+    /// Any other elements are copy-constructed one by one.
+    ///
+    template <typename U>
+    static void copy_construct_n(
+        U* const          dst,
+        const U* const    src,
+        const std::size_t count,
+        typename std::enable_if<!std::is_trivially_copyable<U>::value>::type* =
+            0) noexcept(std::is_nothrow_copy_constructible<U>::value)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            new (&dst[i]) U(src[i]);
+        }
+    }
+
     template <typename U>
     static constexpr bool internal_compare_element(
         const U& lhs,
@@ -852,6 +1182,540 @@ private:
 template <typename T, std::size_t MaxSize, typename Allocator>
 const std::size_t VariableLengthArray<T, MaxSize, Allocator>::type_max_size;
 
+template <typename T, std::size_t MaxSize, typename Allocator>
+const bool VariableLengthArray<T, MaxSize, Allocator>::has_inline_storage;
+
+template <typename T, std::size_t MaxSize, typename Allocator>
+const bool VariableLengthArray<T, MaxSize, Allocator>::IsTriviallyRelocatable;
+
+// +--------------------------------------------------------------------------+
+// | INLINE STORAGE
+// +--------------------------------------------------------------------------+
+namespace detail
+{
+///
+/// The subset of nunavut::support::is_trivially_relocatable that does not depend on the serialization support header:
+/// trivially copyable elements and elements with a true IsTriviallyRelocatable member.
+///
+template <typename T, typename = void>
+struct is_element_trivially_relocatable : std::integral_constant<bool, std::is_trivially_copyable<T>::value>
+{
+};
+
+template <typename T>
+struct is_element_trivially_relocatable<T, decltype(static_cast<void>(T::IsTriviallyRelocatable))>
+    : std::integral_constant<bool, T::IsTriviallyRelocatable>
+{
+};
+
+///
+/// Element storage and special members of InlineVariableLengthArray for elements that need their constructors and
+/// destructors run. Copies and moves go element by element; a moved-from array is left empty.
+///
+template <typename T, std::size_t MaxSize, bool = std::is_trivially_copyable<T>::value>
+class inline_vla_storage
+{
+protected:
+    inline_vla_storage() noexcept
+        : size_(0)
+    {
+    }
+
+    inline_vla_storage(const inline_vla_storage& rhs) noexcept(std::is_nothrow_copy_constructible<T>::value)
+        : size_(0)
+    {
+        copy_from(rhs);
+    }
+
+    inline_vla_storage(inline_vla_storage&& rhs) noexcept(std::is_nothrow_move_constructible<T>::value)
+        : size_(0)
+    {
+        move_from(rhs);
+    }
+
+    inline_vla_storage& operator=(const inline_vla_storage& rhs) noexcept(std::is_nothrow_copy_constructible<T>::value)
+    {
+        if (this != &rhs)
+        {
+            destroy();
+            copy_from(rhs);
+        }
+        return *this;
+    }
+
+    inline_vla_storage& operator=(inline_vla_storage&& rhs) noexcept(std::is_nothrow_move_constructible<T>::value)
+    {
+        if (this != &rhs)
+        {
+            destroy();
+            move_from(rhs);
+        }
+        return *this;
+    }
+
+    ~inline_vla_storage() noexcept(std::is_nothrow_destructible<T>::value)
+    {
+        destroy();
+    }
+
+    T* elements() noexcept
+    {
+        return reinterpret_cast<T*>(storage_);
+    }
+
+    const T* elements() const noexcept
+    {
+        return reinterpret_cast<const T*>(storage_);
+    }
+
+    typename std::aligned_storage<sizeof(T), alignof(T)>::type storage_[MaxSize];
+    std::size_t                                                size_;
+
+private:
+    void copy_from(const inline_vla_storage& rhs)
+    {
+        for (; size_ < rhs.size_; ++size_)
+        {
+            new (&elements()[size_]) T(rhs.elements()[size_]);
+        }
+    }
+
+    void move_from(inline_vla_storage& rhs)
+    {
+        for (; size_ < rhs.size_; ++size_)
+        {
+            new (&elements()[size_]) T(std::move(rhs.elements()[size_]));
+        }
+        rhs.destroy();
+    }
+
+    void destroy() noexcept(std::is_nothrow_destructible<T>::value)
+    {
+        while (size_ > 0)
+        {
+            elements()[--size_].~T();
+        }
+    }
+};
+
+///
+/// Trivially copyable elements need none of that: the storage, and so the array itself, is trivially copyable and
+/// can be relocated with memcpy. A moved-from array keeps its elements.
+///
+template <typename T, std::size_t MaxSize>
+class inline_vla_storage<T, MaxSize, true>
+{
+protected:
+    inline_vla_storage() noexcept
+        : size_(0)
+    {
+    }
+
+    T* elements() noexcept
+    {
+        return reinterpret_cast<T*>(storage_);
+    }
+
+    const T* elements() const noexcept
+    {
+        return reinterpret_cast<const T*>(storage_);
+    }
+
+    typename std::aligned_storage<sizeof(T), alignof(T)>::type storage_[MaxSize];
+    std::size_t                                                size_;
+};
+
+}  // namespace detail
+
+///
+/// Variable-length array with the same interface as VariableLengthArray that keeps up to {@code MaxSize} elements
+/// inside the object instead of allocating them. Nothing is ever allocated: {@code capacity()} is always
+/// {@code MaxSize}, {@code reserve} and {@code shrink_to_fit} do nothing, and the allocator type is only carried
+/// along so generated code can treat both containers alike. Arrays of trivially copyable elements are themselves
+/// trivially copyable.
+///
+/// This container is meant for arrays that are small compared to the cost of a heap allocation; see
+/// SmallVariableLengthArray.
+///
+/// @tparam  T           The type of elements in the array.
+/// @tparam  MaxSize     The maximum allowable size and capacity of the array.
+/// @tparam  Allocator   Ignored; the allocator_type of the equivalent VariableLengthArray.
+///
+template <typename T, std::size_t MaxSize, typename Allocator = MallocAllocator<T>>
+class InlineVariableLengthArray : private detail::inline_vla_storage<T, MaxSize>
+{
+    using base = detail::inline_vla_storage<T, MaxSize>;
+    using base::elements;
+    using base::size_;
+
+public:
+    InlineVariableLengthArray() noexcept = default;
+
+    explicit InlineVariableLengthArray(const Allocator& alloc) noexcept
+    {
+        (void) alloc;
+    }
+
+    InlineVariableLengthArray(std::initializer_list<T> l) noexcept(std::is_nothrow_copy_constructible<T>::value)
+    {
+        for (const T* list_item = l.begin(), *end = l.end(); list_item != end && size_ < MaxSize; ++list_item)
+        {
+            new (&elements()[size_++]) T(*list_item);
+        }
+    }
+
+    template <class InputIt>
+    InlineVariableLengthArray(InputIt           first,
+                              InputIt           last,
+                              const std::size_t length,
+                              const Allocator&  alloc = Allocator()) noexcept(std::is_nothrow_copy_constructible<T>::value)
+    {
+        (void) alloc;
+        for (; first != last && size_ < length && size_ < MaxSize; ++first)
+        {
+            new (&elements()[size_++]) T(*first);
+        }
+    }
+
+    bool operator==(const InlineVariableLengthArray& rhs) const noexcept
+    {
+        if (size() != rhs.size())
+        {
+            return false;
+        }
+        for (std::size_t i = 0; i < size_; ++i)
+        {
+            if (!internal_compare_element(elements()[i], rhs.elements()[i]))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool operator!=(const InlineVariableLengthArray& rhs) const noexcept
+    {
+        return !(operator==(rhs));
+    }
+
+    using pointer        = typename std::add_pointer<T>::type;
+    using allocator_type = Allocator;
+    using iterator       = typename std::add_pointer<T>::type;
+    using const_iterator = typename std::add_pointer<typename std::add_const<T>::type>::type;
+    using value_type     = T;
+
+    ///
+    /// See VariableLengthArray::type_max_size.
+    ///
+    static constexpr const std::size_t type_max_size = MaxSize;
+
+    ///
+    /// True for this container and false for VariableLengthArray. Generated code uses this to skip rebinding the
+    /// array to an arena.
+    ///
+    static constexpr const bool has_inline_storage = true;
+
+    ///
+    /// The elements are part of the array, so this is true if they can be relocated; see VariableLengthArray.
+    ///
+    static constexpr const bool IsTriviallyRelocatable = detail::is_element_trivially_relocatable<T>::value;
+
+    constexpr std::size_t max_size() const noexcept
+    {
+        return type_max_size;
+    }
+
+    // +----------------------------------------------------------------------+
+    // | ELEMENT ACCESS
+    // +----------------------------------------------------------------------+
+    ///
+    /// Unlike VariableLengthArray the data pointer is never null and is only invalidated when this object is moved
+    /// or destroyed.
+    ///
+    const_iterator cbegin() const noexcept
+    {
+        return elements();
+    }
+
+    const_iterator cend() const noexcept
+    {
+        return elements() + size_;
+    }
+
+    iterator begin() noexcept
+    {
+        return elements();
+    }
+
+    iterator end() noexcept
+    {
+        return elements() + size_;
+    }
+
+    T* data() noexcept
+    {
+        return elements();
+    }
+
+    const T* data() const noexcept
+    {
+        return elements();
+    }
+
+    const T& operator[](std::size_t pos) const noexcept
+    {
+        return elements()[pos];
+    }
+
+    T& operator[](std::size_t pos) noexcept
+    {
+        return elements()[pos];
+    }
+
+    const T* at_or_null(std::size_t pos) const noexcept
+    {
+        return (pos < size_) ? &elements()[pos] : nullptr;
+    }
+
+    T* at_or_null(std::size_t pos) noexcept
+    {
+        return (pos < size_) ? &elements()[pos] : nullptr;
+    }
+
+    allocator_type get_allocator() const noexcept
+    {
+        return allocator_type();
+    }
+
+    // +----------------------------------------------------------------------+
+    // | CAPACITY
+    // +----------------------------------------------------------------------+
+    constexpr std::size_t capacity() const noexcept
+    {
+        return MaxSize;
+    }
+
+    constexpr std::size_t size() const noexcept
+    {
+        return size_;
+    }
+
+    ///
+    /// The storage is always there; this only exists for compatibility with VariableLengthArray.
+    ///
+    /// @return {@code MaxSize}.
+    ///
+    std::size_t reserve(const std::size_t desired_capacity) noexcept
+    {
+        (void) desired_capacity;
+        return MaxSize;
+    }
+
+    ///
+    /// The storage cannot be shrunk; this only exists for compatibility with VariableLengthArray.
+    ///
+    /// @return Always true.
+    ///
+    bool shrink_to_fit() noexcept
+    {
+        return true;
+    }
+
+    // +----------------------------------------------------------------------+
+    // | MODIFIERS
+    // +----------------------------------------------------------------------+
+    ///
+    /// See VariableLengthArray::push_back(). The only possible failure is being at {@code MaxSize}.
+    ///
+    /// @throw std::length_error if the size of this collection is at capacity.
+    ///
+    void push_back()
+    {
+        if (ensure_size_plus_one())
+        {
+            new (&elements()[size_++]) T();
+        }
+    }
+
+    void push_back(T&& value)
+    {
+        if (ensure_size_plus_one())
+        {
+            new (&elements()[size_++]) T(std::move(value));
+        }
+    }
+
+    void push_back(const T& value)
+    {
+        if (ensure_size_plus_one())
+        {
+            new (&elements()[size_++]) T(value);
+        }
+    }
+
+    ///
+    /// See VariableLengthArray::resize_for_overwrite().
+    ///
+    /// @throw std::length_error if new_size is greater than max_size.
+    ///
+    std::size_t resize_for_overwrite(const std::size_t new_size)
+    {
+        if (new_size > MaxSize)
+        {
+#if __cpp_exceptions
+            throw std::length_error("Requested size exceeds max size.");
+#endif
+            return size_;
+        }
+        while (size_ > new_size)
+        {
+            pop_back();
+        }
+        construct_for_overwrite<T>(elements(), size_, new_size);
+        size_ = (new_size > size_) ? new_size : size_;
+        return size_;
+    }
+
+    ///
+    /// See VariableLengthArray::append().
+    ///
+    /// @throw std::length_error if the resulting size would be greater than max_size.
+    ///
+    std::size_t append(const T* const src, const std::size_t count)
+    {
+        if ((count == 0) || (count > (MaxSize - size_)))
+        {
+#if __cpp_exceptions
+            if (count > (MaxSize - size_))
+            {
+                throw std::length_error("Cannot append more elements than max size.");
+            }
+#endif
+            return 0;
+        }
+        copy_construct_n<T>(&elements()[size_], src, count);
+        size_ += count;
+        return count;
+    }
+
+    void pop_back() noexcept(std::is_nothrow_destructible<T>::value)
+    {
+        if (size_ > 0)
+        {
+            elements()[--size_].~T();
+        }
+    }
+
+private:
+    bool ensure_size_plus_one()
+    {
+        if (size_ < MaxSize)
+        {
+            return true;
+        }
+#if __cpp_exceptions
+        throw std::length_error("size is at capacity.");
+#endif
+        return false;
+    }
+
+    template <typename U>
+    static void construct_for_overwrite(
+        U* const          data,
+        const std::size_t begin,
+        const std::size_t end,
+        typename std::enable_if<std::is_trivially_default_constructible<U>::value &&
+                                std::is_trivially_copyable<U>::value>::type* = 0) noexcept
+    {
+        (void) data;
+        (void) begin;
+        (void) end;
+    }
+
+    template <typename U>
+    static void construct_for_overwrite(
+        U* const          data,
+        const std::size_t begin,
+        const std::size_t end,
+        typename std::enable_if<!(std::is_trivially_default_constructible<U>::value &&
+                                  std::is_trivially_copyable<U>::value)>::type* =
+            0) noexcept(std::is_nothrow_default_constructible<U>::value)
+    {
+        for (std::size_t i = begin; i < end; ++i)
+        {
+            new (&data[i]) U();
+        }
+    }
+
+    template <typename U>
+    static void copy_construct_n(U* const          dst,
+                                 const U* const    src,
+                                 const std::size_t count,
+                                 typename std::enable_if<std::is_trivially_copyable<U>::value>::type* = 0) noexcept
+    {
+        std::memcpy(dst, src, count * sizeof(U));
+    }
+
+    template <typename U>
+    static void copy_construct_n(
+        U* const          dst,
+        const U* const    src,
+        const std::size_t count,
+        typename std::enable_if<!std::is_trivially_copyable<U>::value>::type* =
+            0) noexcept(std::is_nothrow_copy_constructible<U>::value)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            new (&dst[i]) U(src[i]);
+        }
+    }
+
+    template <typename U>
+    static bool internal_compare_element(
+        const U& lhs,
+        const U& rhs,
+        typename std::enable_if<!std::is_floating_point<U>::value>::type* = 0) noexcept
+    {
+        return (lhs == rhs);
+    }
+
+    ///
+    /// Same tolerance as VariableLengthArray::internal_compare_element.
+    ///
+    template <typename U>
+    static bool internal_compare_element(
+        const U& lhs,
+        const U& rhs,
+        typename std::enable_if<std::is_floating_point<U>::value>::type* = 0) noexcept
+    {
+        const auto diff    = std::fabs(lhs - rhs);
+        const auto sum     = std::fabs(lhs + rhs);
+        const auto epsilon = std::numeric_limits<U>::epsilon() * sum;
+
+        return (diff <= epsilon) || diff < std::numeric_limits<U>::min();
+    }
+};
+
+// required till C++ 17. Redundant but allowed after that.
+template <typename T, std::size_t MaxSize, typename Allocator>
+const std::size_t InlineVariableLengthArray<T, MaxSize, Allocator>::type_max_size;
+
+template <typename T, std::size_t MaxSize, typename Allocator>
+const bool InlineVariableLengthArray<T, MaxSize, Allocator>::has_inline_storage;
+
+template <typename T, std::size_t MaxSize, typename Allocator>
+const bool InlineVariableLengthArray<T, MaxSize, Allocator>::IsTriviallyRelocatable;
+
+///
+/// The container generated types use for variable-length arrays when the ``variable_array_inline_below_bytes``
+/// language option is set: an InlineVariableLengthArray if {@code MaxSize} elements take fewer than
+/// {@code InlineBelowBytes} bytes, otherwise a VariableLengthArray using {@code Allocator}.
+///
+template <typename T, std::size_t MaxSize, std::size_t InlineBelowBytes, typename Allocator = MallocAllocator<T>>
+using SmallVariableLengthArray = typename std::conditional<(MaxSize * sizeof(T) < InlineBelowBytes),
+                                                           InlineVariableLengthArray<T, MaxSize, Allocator>,
+                                                           VariableLengthArray<T, MaxSize, Allocator>>::type;
+
 }  // namespace support
 }  // namespace nunavut
 
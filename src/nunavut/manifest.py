@@ -0,0 +1,166 @@
+#
+# Copyright 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+# Copyright (C) 2018-2021  UAVCAN Development Team  <uavcan.org>
+# This software is distributed under the terms of the MIT License.
+#
+"""
+Records what each generated file was generated from so that later runs can skip the types whose inputs did not change.
+"""
+
+import hashlib
+import json
+import logging
+import os
+import pathlib
+import typing
+
+import pydsdl
+
+from .dependencies import DependencyBuilder
+
+logger = logging.getLogger(__name__)
+
+
+def _digest_file(path: pathlib.Path) -> str:
+    with open(str(path), "rb") as f:
+        return hashlib.sha256(f.read()).hexdigest()
+
+
+class GenerationManifest:
+    """
+    A persistent mapping from output files to a fingerprint of everything that went into them. The fingerprint of a
+    type covers its DSDL source, the sources of all the types it depends on (see
+    :class:`nunavut.dependencies.DependencyBuilder`), and a caller-provided digest of the templates and the options
+    used. A change to any of these, including to a type several levels down, changes the fingerprint so that exactly
+    the dependents of a changed type are generated again.
+
+    .. invisible-code-block: python
+
+        import pathlib
+        import tempfile
+        from unittest.mock import MagicMock
+        import pydsdl
+        from nunavut.manifest import GenerationManifest
+
+        with tempfile.TemporaryDirectory() as tmp:
+            tmp_path = pathlib.Path(tmp)
+            dsdl = tmp_path / "Foo.1.0.uavcan"
+            dsdl.write_text("uint8 a\\n")
+            foo = MagicMock(spec=pydsdl.CompositeType)
+            foo.parent_service = False
+            foo.attributes = []
+            foo.full_name = "ns.Foo"
+            foo.version = pydsdl.Version(1, 0)
+            foo.source_file_path = dsdl
+            output = tmp_path / "Foo_1_0.h"
+
+            manifest = GenerationManifest(tmp_path / "manifest.json", "templates+options")
+            fingerprint = manifest.fingerprint(foo)
+            assert not manifest.is_current(output, fingerprint)
+
+            output.write_text("generated")
+            manifest.record(output, fingerprint)
+            manifest.save()
+
+            reloaded = GenerationManifest(tmp_path / "manifest.json", "templates+options")
+            assert reloaded.is_current(output, reloaded.fingerprint(foo))
+
+            # Changing the DSDL, the output file, or the templates and options all invalidate the entry.
+            dsdl.write_text("uint16 a\\n")
+            assert not reloaded.is_current(output, GenerationManifest(tmp_path / "m", "").fingerprint(foo))
+            assert not GenerationManifest(tmp_path / "manifest.json", "other").is_current(output, fingerprint)
+
+    :param pathlib.Path path: The file the manifest is loaded from and saved to. It is fine for it not to exist.
+    :param str generator_digest: Digest of the templates, options, and anything else that affects all outputs alike.
+    """
+
+    VERSION = 1  #: Manifests written with a different version are ignored.
+
+    def __init__(self, path: pathlib.Path, generator_digest: str):
+        self._path = path
+        self._generator_digest = generator_digest
+        self._source_digests = dict()  # type: typing.Dict[pathlib.Path, str]
+        self._entries = dict()  # type: typing.Dict[str, typing.Dict[str, str]]
+        self._recorded = dict()  # type: typing.Dict[str, typing.Dict[str, str]]
+        try:
+            with open(str(path), "r") as f:
+                contents = json.load(f)
+            if contents.get("version") == self.VERSION and contents.get("generator") == generator_digest:
+                self._entries = contents.get("outputs", dict())
+            else:
+                logger.info("Manifest %s is for other templates or options; generating everything.", path)
+        except FileNotFoundError:
+            pass
+        except (ValueError, AttributeError) as e:
+            logger.warning("Ignoring unreadable manifest %s: %s", path, e)
+
+    @property
+    def path(self) -> pathlib.Path:
+        return self._path
+
+    def fingerprint(self, t: pydsdl.CompositeType) -> str:
+        """
+        The fingerprint of a type: a digest of the DSDL sources of the type and its transitive dependencies.
+        """
+        types = [t] + sorted(DependencyBuilder(t).transitive().composite_types, key=lambda dt: str(dt.full_name))
+        hasher = hashlib.sha256()
+        for dt in types:
+            hasher.update("{}.{}.{}:".format(dt.full_name, dt.version.major, dt.version.minor).encode("utf-8"))
+            hasher.update(self._source_digest(pathlib.Path(dt.source_file_path)).encode("utf-8"))
+        return hasher.hexdigest()
+
+    def is_current(self, output_path: pathlib.Path, fingerprint: str) -> bool:
+        """
+        True if the output file exists, is the same as the one recorded, and was generated from inputs with the given
+        fingerprint. Output files edited since they were generated are therefore generated again.
+        """
+        entry = self._entries.get(output_path.as_posix())
+        if entry is None or entry.get("fingerprint") != fingerprint:
+            return False
+        try:
+            return bool(entry.get("output") == _digest_file(output_path))
+        except FileNotFoundError:
+            return False
+
+    def keep(self, output_path: pathlib.Path) -> None:
+        """
+        Carry the entry of an output file found to be current over to the manifest saved by :meth:`save`.
+        """
+        self._recorded[output_path.as_posix()] = self._entries[output_path.as_posix()]
+
+    def record(self, output_path: pathlib.Path, fingerprint: str) -> None:
+        """
+        Note that the output file, as it is now, was generated from inputs with the given fingerprint.
+        """
+        self._recorded[output_path.as_posix()] = {"fingerprint": fingerprint, "output": _digest_file(output_path)}
+
+    def save(self) -> None:
+        """
+        Write the entries kept or recorded since this object was created, replacing the previous manifest atomically.
+        Outputs that were neither are dropped, so the manifest does not grow with types removed from the namespace.
+        Nothing is written if the entries are the same as those loaded.
+        """
+        if self._recorded == self._entries and self._path.exists():
+            return
+        self._path.parent.mkdir(parents=True, exist_ok=True)
+        temporary = self._path.with_name("{}.{}.tmp".format(self._path.name, os.getpid()))
+        with open(str(temporary), "w") as f:
+            json.dump(
+                {"version": self.VERSION, "generator": self._generator_digest, "outputs": self._recorded},
+                f,
+                indent=1,
+                sort_keys=True,
+            )
+        os.replace(str(temporary), str(self._path))
+
+    # +-----------------------------------------------------------------------+
+    # | PRIVATE
+    # +-----------------------------------------------------------------------+
+
+    def _source_digest(self, path: pathlib.Path) -> str:
+        try:
+            return self._source_digests[path]
+        except KeyError:
+            digest = _digest_file(path)
+            self._source_digests[path] = digest
+            return digest
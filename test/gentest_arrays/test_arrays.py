@@ -79,3 +79,31 @@ def test_var_array_override_cpp(gen_paths):  # type: ignore
         re.compile(r'\s*scotec::TerribleArray<float,2677>\s+antennae_per_bank;\s*'),
         re.compile(r'\s*std::array<float,3>\s+bank_normal_rads;\s*')
     )
+
+
+def test_var_array_override_deserialization_reuse_cpp(gen_paths):  # type: ignore
+    """
+    Custom variable-length array types are filled with push_back(), so with deserialization reuse the union
+    alternatives holding them must still be constructed again; only the fixed-length ones are reused in place.
+    """
+    language_option_overrides = {'variable_array_type_template': 'scotec::TerribleArray<{TYPE},{MAX_SIZE}>',
+                                 'enable_deserialization_reuse': True}
+    root_namespace = str(gen_paths.dsdl_dir / Path("sonar"))
+    compound_types = pydsdl.read_namespace(root_namespace, [], allow_unregulated_fixed_port_id=True)
+    language_context = LanguageContext('cpp',
+                                       language_options=language_option_overrides)
+
+    namespace = build_namespace_tree(compound_types,
+                                     root_namespace,
+                                     gen_paths.out_dir,
+                                     language_context)
+    generator = DSDLCodeGenerator(namespace)
+    generator.generate_all(False)
+
+    outfile = gen_paths.find_outfile_in_namespace("sonar.Ping", namespace)
+    assert_pattern_match_in_file(
+        outfile,
+        re.compile(r'\s*if \(not is_bearing\(\)\)\s*')
+    )
+    with open(str(outfile), 'r') as file_handle:
+        assert re.search(r'is_echoes\(\)\)\s*\{\s*set_echoes\(\);', file_handle.read()) is None
@@ -232,6 +232,37 @@ def test_list_outputs_builtin_pod(gen_paths: typing.Any, run_nnvg: typing.Callab
     assert expected_output == sorted(completed_wo_empty)
 
 
+def test_list_outputs_out_of_line_serialization(gen_paths: typing.Any, run_nnvg: typing.Callable) -> None:
+    """
+    Verifies that --enable-out-of-line-serialization lists a source file along with each C++ header.
+    """
+    test_path = gen_paths.out_dir / pathlib.Path("uavcan") / pathlib.Path("test")
+
+    nnvg_args = [
+        "-O",
+        gen_paths.out_dir.as_posix(),
+        "--target-language",
+        "cpp",
+        "--experimental-languages",
+        "-I",
+        (gen_paths.dsdl_dir / pathlib.Path("scotec")).as_posix(),
+        "--list-outputs",
+        "--enable-out-of-line-serialization",
+        (gen_paths.dsdl_dir / pathlib.Path("uavcan")).as_posix(),
+    ]
+
+    completed = run_nnvg(gen_paths, nnvg_args).stdout.decode("utf-8").split(";")
+    completed_wo_empty = [pathlib.Path(i) for i in completed if len(i) > 0]
+    assert test_path / pathlib.Path("TestType_0_8").with_suffix(".hpp") in completed_wo_empty
+    assert test_path / pathlib.Path("TestType_0_8").with_suffix(".cpp") in completed_wo_empty
+
+    # Types matched by --inline-serialization-types keep everything in their header.
+    completed = run_nnvg(gen_paths, nnvg_args[:-1] + ["--inline-serialization-types", "uavcan.test.*", nnvg_args[-1]])
+    completed_wo_empty = [pathlib.Path(i) for i in completed.stdout.decode("utf-8").split(";") if len(i) > 0]
+    assert test_path / pathlib.Path("TestType_0_8").with_suffix(".hpp") in completed_wo_empty
+    assert test_path / pathlib.Path("TestType_0_8").with_suffix(".cpp") not in completed_wo_empty
+
+
 def test_version(gen_paths: typing.Any, run_nnvg: typing.Callable) -> None:
     """
     Verifies nnvg's --version
@@ -298,6 +329,17 @@ def test_language_option_defaults(gen_paths: typing.Any, run_nnvg: typing.Callab
         assert generated_results["target_endianness"] == "any"
         assert not generated_results["omit_float_serialization_support"]
         assert not generated_results["enable_serialization_asserts"]
+        assert generated_results["enable_unchecked_fixed_length_serialization"]
+        assert not generated_results["enable_allocator_support"]
+        assert not generated_results["enable_view_types"]
+        assert not generated_results["enable_stream_serialization"]
+        assert generated_results["unaligned_copy_engine"] == "word"
+        assert generated_results["variable_array_inline_below_bytes"] == 0
+        assert not generated_results["enable_out_of_line_serialization"]
+        assert generated_results["inline_serialization_types"] == ""
+        assert generated_results["table_serialization_types"] == ""
+        assert not generated_results["enable_serialization_tracing"]
+        assert not generated_results["enable_deserialization_reuse"]
 
 
 @pytest.mark.parametrize("target_endianness_override", ["any", "big", "little"])
@@ -415,6 +457,242 @@ def test_language_option_generate_asserts(gen_paths: typing.Any, run_nnvg: typin
         assert generated_results["enable_serialization_asserts"]
 
 
+def test_language_option_disable_unchecked_fixed_length_serialization(
+    gen_paths: typing.Any, run_nnvg: typing.Callable
+) -> None:
+    """
+    Verifies that the --disable-unchecked-fixed-length-serialization option is wired up in nnvg.
+    """
+
+    expected_output = (
+        gen_paths.out_dir / pathlib.Path("uavcan") / pathlib.Path("test") / pathlib.Path("TestType_0_8.hpp")
+    )
+
+    nnvg_args = [
+        "--templates",
+        gen_paths.templates_dir.as_posix(),
+        "-O",
+        gen_paths.out_dir.as_posix(),
+        "--target-language",
+        "cpp",
+        "--experimental-languages",
+        "-I",
+        (gen_paths.dsdl_dir / pathlib.Path("scotec")).as_posix(),
+        "--disable-unchecked-fixed-length-serialization",
+        (gen_paths.dsdl_dir / pathlib.Path("uavcan")).as_posix(),
+    ]
+
+    run_nnvg(gen_paths, nnvg_args).stdout.decode("utf-8").split(";")
+    with open(expected_output, "r") as generated:
+        generated_results = json.load(generated)
+        assert not generated_results["enable_unchecked_fixed_length_serialization"]
+
+
+def test_language_option_enable_allocator_support(gen_paths: typing.Any, run_nnvg: typing.Callable) -> None:
+    """
+    Verifies that the --enable-allocator-support option is wired up in nnvg.
+    """
+
+    expected_output = (
+        gen_paths.out_dir / pathlib.Path("uavcan") / pathlib.Path("test") / pathlib.Path("TestType_0_8.hpp")
+    )
+
+    nnvg_args = [
+        "--templates",
+        gen_paths.templates_dir.as_posix(),
+        "-O",
+        gen_paths.out_dir.as_posix(),
+        "--target-language",
+        "cpp",
+        "--experimental-languages",
+        "-I",
+        (gen_paths.dsdl_dir / pathlib.Path("scotec")).as_posix(),
+        "--enable-allocator-support",
+        (gen_paths.dsdl_dir / pathlib.Path("uavcan")).as_posix(),
+    ]
+
+    run_nnvg(gen_paths, nnvg_args).stdout.decode("utf-8").split(";")
+    with open(expected_output, "r") as generated:
+        generated_results = json.load(generated)
+        assert generated_results["enable_allocator_support"]
+
+
+def test_language_option_view_types(gen_paths: typing.Any, run_nnvg: typing.Callable) -> None:
+    """
+    Verifies that the --enable-view-types option is wired up in nnvg.
+    """
+
+    expected_output = (
+        gen_paths.out_dir / pathlib.Path("uavcan") / pathlib.Path("test") / pathlib.Path("TestType_0_8.hpp")
+    )
+
+    nnvg_args = [
+        "--templates",
+        gen_paths.templates_dir.as_posix(),
+        "-O",
+        gen_paths.out_dir.as_posix(),
+        "--target-language",
+        "cpp",
+        "--experimental-languages",
+        "-I",
+        (gen_paths.dsdl_dir / pathlib.Path("scotec")).as_posix(),
+        "--enable-view-types",
+        (gen_paths.dsdl_dir / pathlib.Path("uavcan")).as_posix(),
+    ]
+
+    run_nnvg(gen_paths, nnvg_args).stdout.decode("utf-8").split(";")
+    with open(expected_output, "r") as generated:
+        generated_results = json.load(generated)
+        assert generated_results["enable_view_types"]
+
+
+def test_language_option_stream_serialization(gen_paths: typing.Any, run_nnvg: typing.Callable) -> None:
+    """
+    Verifies that the --enable-stream-serialization option is wired up in nnvg.
+    """
+
+    expected_output = (
+        gen_paths.out_dir / pathlib.Path("uavcan") / pathlib.Path("test") / pathlib.Path("TestType_0_8.hpp")
+    )
+
+    nnvg_args = [
+        "--templates",
+        gen_paths.templates_dir.as_posix(),
+        "-O",
+        gen_paths.out_dir.as_posix(),
+        "--target-language",
+        "cpp",
+        "--experimental-languages",
+        "-I",
+        (gen_paths.dsdl_dir / pathlib.Path("scotec")).as_posix(),
+        "--enable-stream-serialization",
+        (gen_paths.dsdl_dir / pathlib.Path("uavcan")).as_posix(),
+    ]
+
+    run_nnvg(gen_paths, nnvg_args).stdout.decode("utf-8").split(";")
+    with open(expected_output, "r") as generated:
+        generated_results = json.load(generated)
+        assert generated_results["enable_stream_serialization"]
+
+
+def test_language_option_variable_array_inline_below_bytes(gen_paths: typing.Any, run_nnvg: typing.Callable) -> None:
+    """
+    Verifies that the --variable-array-inline-below-bytes option is wired up in nnvg.
+    """
+
+    expected_output = (
+        gen_paths.out_dir / pathlib.Path("uavcan") / pathlib.Path("test") / pathlib.Path("TestType_0_8.hpp")
+    )
+
+    nnvg_args = [
+        "--templates",
+        gen_paths.templates_dir.as_posix(),
+        "-O",
+        gen_paths.out_dir.as_posix(),
+        "--target-language",
+        "cpp",
+        "--experimental-languages",
+        "-I",
+        (gen_paths.dsdl_dir / pathlib.Path("scotec")).as_posix(),
+        "--variable-array-inline-below-bytes",
+        "64",
+        (gen_paths.dsdl_dir / pathlib.Path("uavcan")).as_posix(),
+    ]
+
+    run_nnvg(gen_paths, nnvg_args).stdout.decode("utf-8").split(";")
+    with open(expected_output, "r") as generated:
+        generated_results = json.load(generated)
+        assert generated_results["variable_array_inline_below_bytes"] == 64
+
+
+def test_language_option_serialization_tracing(gen_paths: typing.Any, run_nnvg: typing.Callable) -> None:
+    """
+    Verifies that the --enable-serialization-tracing option is wired up in nnvg.
+    """
+
+    expected_output = (
+        gen_paths.out_dir / pathlib.Path("uavcan") / pathlib.Path("test") / pathlib.Path("TestType_0_8.hpp")
+    )
+
+    nnvg_args = [
+        "--templates",
+        gen_paths.templates_dir.as_posix(),
+        "-O",
+        gen_paths.out_dir.as_posix(),
+        "--target-language",
+        "cpp",
+        "--experimental-languages",
+        "-I",
+        (gen_paths.dsdl_dir / pathlib.Path("scotec")).as_posix(),
+        "--enable-serialization-tracing",
+        (gen_paths.dsdl_dir / pathlib.Path("uavcan")).as_posix(),
+    ]
+
+    run_nnvg(gen_paths, nnvg_args).stdout.decode("utf-8").split(";")
+    with open(expected_output, "r") as generated:
+        generated_results = json.load(generated)
+        assert generated_results["enable_serialization_tracing"]
+
+
+def test_language_option_deserialization_reuse(gen_paths: typing.Any, run_nnvg: typing.Callable) -> None:
+    """
+    Verifies that the --enable-deserialization-reuse option is wired up in nnvg.
+    """
+
+    expected_output = (
+        gen_paths.out_dir / pathlib.Path("uavcan") / pathlib.Path("test") / pathlib.Path("TestType_0_8.hpp")
+    )
+
+    nnvg_args = [
+        "--templates",
+        gen_paths.templates_dir.as_posix(),
+        "-O",
+        gen_paths.out_dir.as_posix(),
+        "--target-language",
+        "cpp",
+        "--experimental-languages",
+        "-I",
+        (gen_paths.dsdl_dir / pathlib.Path("scotec")).as_posix(),
+        "--enable-deserialization-reuse",
+        (gen_paths.dsdl_dir / pathlib.Path("uavcan")).as_posix(),
+    ]
+
+    run_nnvg(gen_paths, nnvg_args).stdout.decode("utf-8").split(";")
+    with open(expected_output, "r") as generated:
+        generated_results = json.load(generated)
+        assert generated_results["enable_deserialization_reuse"]
+
+
+def test_language_option_table_serialization_types(gen_paths: typing.Any, run_nnvg: typing.Callable) -> None:
+    """
+    Verifies that the --table-serialization-types option is wired up in nnvg.
+    """
+
+    expected_output = (
+        gen_paths.out_dir / pathlib.Path("uavcan") / pathlib.Path("test") / pathlib.Path("TestType_0_8.hpp")
+    )
+
+    nnvg_args = [
+        "--templates",
+        gen_paths.templates_dir.as_posix(),
+        "-O",
+        gen_paths.out_dir.as_posix(),
+        "--target-language",
+        "cpp",
+        "--experimental-languages",
+        "-I",
+        (gen_paths.dsdl_dir / pathlib.Path("scotec")).as_posix(),
+        "--table-serialization-types",
+        "uavcan.test.*",
+        (gen_paths.dsdl_dir / pathlib.Path("uavcan")).as_posix(),
+    ]
+
+    run_nnvg(gen_paths, nnvg_args).stdout.decode("utf-8").split(";")
+    with open(expected_output, "r") as generated:
+        generated_results = json.load(generated)
+        assert generated_results["table_serialization_types"] == "uavcan.test.*"
+
+
 def test_generate_support_only(gen_paths: typing.Any, run_nnvg: typing.Callable) -> None:
     """
     Verifies expected language option defaults can be overridden.
@@ -480,6 +758,74 @@ def test_generate_support(
                 assert not type_output_path.exists()
 
 
+def test_incremental(gen_paths: typing.Any, run_nnvg: typing.Callable) -> None:
+    """
+    Covers nnvg --incremental and --jobs: a second run over unchanged inputs must not touch any output.
+    """
+    support_output = gen_paths.out_dir / pathlib.Path("nunavut") / pathlib.Path("support") / "serialization.h"
+    type_output = gen_paths.out_dir / pathlib.Path("uavcan") / pathlib.Path("test") / pathlib.Path("TestType_0_8.h")
+    manifest = gen_paths.out_dir / pathlib.Path(".nunavut-c-uavcan.manifest.json")
+
+    nnvg_args = [
+        "-O",
+        gen_paths.out_dir.as_posix(),
+        "--target-language",
+        "c",
+        "-I",
+        (gen_paths.dsdl_dir / pathlib.Path("scotec")).as_posix(),
+        "--incremental",
+        "--jobs",
+        "2",
+        (gen_paths.dsdl_dir / pathlib.Path("uavcan")).as_posix(),
+    ]
+
+    run_nnvg(gen_paths, nnvg_args)
+    assert manifest.exists()
+    first_mtimes = (support_output.stat().st_mtime_ns, type_output.stat().st_mtime_ns)
+    first_contents = type_output.read_text()
+
+    run_nnvg(gen_paths, nnvg_args)
+    assert first_mtimes == (support_output.stat().st_mtime_ns, type_output.stat().st_mtime_ns)
+    assert first_contents == type_output.read_text()
+
+    with open(str(manifest), "r") as manifest_file:
+        assert type_output.as_posix() in json.load(manifest_file)["outputs"]
+
+
+def test_template_cache(gen_paths: typing.Any, run_nnvg: typing.Callable) -> None:
+    """
+    Covers nnvg --template-cache-dir and --no-template-cache.
+    """
+    cache_dir = gen_paths.out_dir / pathlib.Path("template_cache")
+    type_output = gen_paths.out_dir / pathlib.Path("uavcan") / pathlib.Path("test") / pathlib.Path("TestType_0_8.h")
+
+    nnvg_args = [
+        "-O",
+        gen_paths.out_dir.as_posix(),
+        "--target-language",
+        "c",
+        "-I",
+        (gen_paths.dsdl_dir / pathlib.Path("scotec")).as_posix(),
+        (gen_paths.dsdl_dir / pathlib.Path("uavcan")).as_posix(),
+    ]
+
+    run_nnvg(gen_paths, nnvg_args + ["--no-template-cache", "--template-cache-dir", cache_dir.as_posix()])
+    assert not cache_dir.exists()
+    uncached_output = type_output.read_text()
+
+    run_nnvg(gen_paths, nnvg_args + ["--template-cache-dir", cache_dir.as_posix()])
+    cache_entries = sorted(cache_dir.iterdir())
+    assert len(cache_entries) > 0
+
+    run_nnvg(gen_paths, nnvg_args + ["--template-cache-dir", cache_dir.as_posix()])
+    assert cache_entries == sorted(cache_dir.iterdir())
+
+    def _without_timestamp(text: str) -> str:
+        return "\n".join(line for line in text.splitlines() if "Generated at" not in line)
+
+    assert _without_timestamp(uncached_output) == _without_timestamp(type_output.read_text())
+
+
 def test_issue_73(gen_paths: typing.Any, run_nnvg: typing.Callable) -> None:
     """
     Verify that https://github.com/OpenCyphal/nunavut/issues/73 hasn't regressed.
@@ -573,3 +919,30 @@ def test_language_allow_unregulated_fixed_portid(gen_paths: typing.Any, run_nnvg
     completed = run_nnvg(gen_paths, nnvg_args).stdout.decode("utf-8").split(";")
     completed_wo_empty = sorted([pathlib.Path(i) for i in completed if len(i) > 0])
     assert expected_output == sorted(completed_wo_empty)
+
+
+def test_cpp_namespace_port_dispatch(gen_paths: typing.Any, run_nnvg: typing.Callable) -> None:
+    """
+    Verifies that the C++ namespace headers list the types with a fixed port-ID in their dispatch tables.
+    """
+    nnvg_args = [
+        "-O",
+        gen_paths.out_dir.as_posix(),
+        "--target-language",
+        "cpp",
+        "--experimental-languages",
+        "-I",
+        (gen_paths.dsdl_dir / pathlib.Path("scotec")).as_posix(),
+        "--allow-unregulated-fixed-port-id",
+        "--generate-namespace-types",
+        (gen_paths.dsdl_dir / pathlib.Path("fixedid")).as_posix(),
+    ]
+
+    run_nnvg(gen_paths, nnvg_args)
+    namespace_header = (gen_paths.out_dir / pathlib.Path("fixedid") / pathlib.Path("_namespace_.hpp")).read_text()
+    assert '#include "nunavut/support/port_dispatch.hpp"' in namespace_header
+    assert '#include "fixedid/Timer_1_0.hpp"' in namespace_header
+    assert 'make_port_dispatch_entry<fixedid::Timer_1_0>("fixedid.Timer.1.0")' in namespace_header
+    assert "PortDispatchTable Messages{MessageEntries, 1U};" in namespace_header
+    assert "PortDispatchTable Requests{nullptr, 0U};" in namespace_header
+    assert (gen_paths.out_dir / pathlib.Path("nunavut") / pathlib.Path("support") / "port_dispatch.hpp").exists()
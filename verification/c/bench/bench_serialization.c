@@ -0,0 +1,542 @@
+// Copyright (c) 2023 UAVCAN Development Team.
+// This software is distributed under the terms of the MIT License.
+//
+// Throughput of the C serialization support library and of generated types; the C counterpart of
+// verification/cpp/bench. There is no benchmark framework for C so this file carries a small harness that accepts the
+// same basic options as Google Benchmark and writes its JSON schema, so that results of both can be processed by the
+// same tools:
+//
+//     bench_serialization [--benchmark_filter=<substring>] [--benchmark_min_time=<seconds>]
+//                         [--benchmark_out=<file>] [--benchmark_out_format=json]
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <regulated/basics/Struct__0_1.h>
+#include <regulated/basics/Primitive_0_1.h>
+#include <regulated/basics/PrimitiveArrayVariable_0_1.h>
+#include <uavcan/node/Heartbeat_1_0.h>
+#include <uavcan/node/GetInfo_1_0.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// Results are accumulated here so that the compiler cannot drop the work being measured.
+static volatile uint64_t g_sink;
+
+// +--------------------------------------------------------------------------+
+// | Harness
+// +--------------------------------------------------------------------------+
+
+typedef void (*BenchFunction)(const void* arg, size_t iterations);
+
+typedef struct
+{
+    char name[96];
+    BenchFunction function;
+    const void* arg;
+    size_t bytes_per_iteration;
+    size_t items_per_iteration;
+} Benchmark;
+
+#define MAX_BENCHMARKS 128U
+
+static Benchmark g_benchmarks[MAX_BENCHMARKS];
+static size_t g_benchmark_count = 0U;
+
+static Benchmark* addBenchmark(const char* const name, const BenchFunction function, const void* const arg)
+{
+    if (g_benchmark_count >= MAX_BENCHMARKS)
+    {
+        (void) fprintf(stderr, "Too many benchmarks\n");
+        exit(EXIT_FAILURE);
+    }
+    Benchmark* const bench = &g_benchmarks[g_benchmark_count++];
+    (void) snprintf(bench->name, sizeof(bench->name), "%s", name);
+    bench->function            = function;
+    bench->arg                 = arg;
+    bench->bytes_per_iteration = 0U;
+    bench->items_per_iteration = 0U;
+    return bench;
+}
+
+static double nowNs(const clockid_t clock)
+{
+    struct timespec ts;
+    (void) clock_gettime(clock, &ts);
+    return ((double) ts.tv_sec * 1e9) + (double) ts.tv_nsec;
+}
+
+typedef struct
+{
+    size_t iterations;
+    double real_ns;
+    double cpu_ns;
+} Measurement;
+
+/// Runs the benchmark with growing iteration counts until it takes at least min_time_s, like Google Benchmark does.
+static Measurement measure(const Benchmark* const bench, const double min_time_s)
+{
+    Measurement m = {1U, 0.0, 0.0};
+    for (;;)
+    {
+        const double real_start = nowNs(CLOCK_MONOTONIC);
+        const double cpu_start  = nowNs(CLOCK_PROCESS_CPUTIME_ID);
+        bench->function(bench->arg, m.iterations);
+        m.real_ns = nowNs(CLOCK_MONOTONIC) - real_start;
+        m.cpu_ns  = nowNs(CLOCK_PROCESS_CPUTIME_ID) - cpu_start;
+        if ((m.real_ns >= (min_time_s * 1e9)) || (m.iterations >= ((size_t) 1U << 40U)))
+        {
+            return m;
+        }
+        const double target = (min_time_s * 1e9 * 1.4) / ((m.real_ns > 1.0) ? m.real_ns : 1.0);
+        const size_t next   = (size_t) ((double) m.iterations * ((target < 10.0) ? target : 10.0));
+        m.iterations        = (next > m.iterations) ? next : (m.iterations + 1U);
+    }
+}
+
+static void writeJsonEntry(FILE* const out, const Benchmark* const bench, const Measurement* const m, const bool last)
+{
+    const double iterations = (double) m->iterations;
+    (void) fprintf(out, "    {\n");
+    (void) fprintf(out, "      \"name\": \"%s\",\n", bench->name);
+    (void) fprintf(out, "      \"run_name\": \"%s\",\n", bench->name);
+    (void) fprintf(out, "      \"run_type\": \"iteration\",\n");
+    (void) fprintf(out, "      \"iterations\": %zu,\n", m->iterations);
+    (void) fprintf(out, "      \"real_time\": %.6e,\n", m->real_ns / iterations);
+    (void) fprintf(out, "      \"cpu_time\": %.6e,\n", m->cpu_ns / iterations);
+    if (bench->bytes_per_iteration > 0U)
+    {
+        (void) fprintf(out, "      \"bytes_per_second\": %.6e,\n",
+                       ((double) bench->bytes_per_iteration * iterations * 1e9) / m->cpu_ns);
+    }
+    if (bench->items_per_iteration > 0U)
+    {
+        (void) fprintf(out, "      \"items_per_second\": %.6e,\n",
+                       ((double) bench->items_per_iteration * iterations * 1e9) / m->cpu_ns);
+    }
+    (void) fprintf(out, "      \"time_unit\": \"ns\"\n");
+    (void) fprintf(out, "    }%s\n", last ? "" : ",");
+}
+
+static int runBenchmarks(const int argc, char* const argv[])
+{
+    const char* filter   = "";
+    const char* out_path = NULL;
+    double min_time_s    = 0.5;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (0 == strncmp(argv[i], "--benchmark_filter=", 19U))
+        {
+            filter = &argv[i][19];
+        }
+        else if (0 == strncmp(argv[i], "--benchmark_min_time=", 21U))
+        {
+            min_time_s = atof(&argv[i][21]);
+        }
+        else if (0 == strncmp(argv[i], "--benchmark_out=", 16U))
+        {
+            out_path = &argv[i][16];
+        }
+        else if (0 == strcmp(argv[i], "--benchmark_out_format=json"))
+        {
+            // JSON is the only format written to files.
+        }
+        else
+        {
+            (void) fprintf(stderr, "Unknown argument: %s\n", argv[i]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    FILE* out = NULL;
+    if (out_path != NULL)
+    {
+        out = fopen(out_path, "w");
+        if (out == NULL)
+        {
+            (void) fprintf(stderr, "Cannot open %s\n", out_path);
+            return EXIT_FAILURE;
+        }
+        const time_t now = time(NULL);
+        char date[32];
+        (void) strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", localtime(&now));
+        (void) fprintf(out, "{\n  \"context\": {\n");
+        (void) fprintf(out, "    \"date\": \"%s\",\n", date);
+        (void) fprintf(out, "    \"executable\": \"%s\",\n", argv[0]);
+        (void) fprintf(out, "    \"library\": \"nunavut-c\"\n  },\n  \"benchmarks\": [\n");
+    }
+
+    (void) printf("%-56s %14s %14s %12s\n", "Benchmark", "Time (ns)", "CPU (ns)", "Iterations");
+    size_t selected = 0U;
+    for (size_t i = 0U; i < g_benchmark_count; ++i)
+    {
+        selected += (NULL != strstr(g_benchmarks[i].name, filter)) ? 1U : 0U;
+    }
+    size_t written = 0U;
+    for (size_t i = 0U; i < g_benchmark_count; ++i)
+    {
+        const Benchmark* const bench = &g_benchmarks[i];
+        if (NULL == strstr(bench->name, filter))
+        {
+            continue;
+        }
+        const Measurement m = measure(bench, min_time_s);
+        (void) printf("%-56s %14.1f %14.1f %12zu\n",
+                      bench->name,
+                      m.real_ns / (double) m.iterations,
+                      m.cpu_ns / (double) m.iterations,
+                      m.iterations);
+        if (out != NULL)
+        {
+            ++written;
+            writeJsonEntry(out, bench, &m, written == selected);
+        }
+    }
+
+    if (out != NULL)
+    {
+        (void) fprintf(out, "  ]\n}\n");
+        (void) fclose(out);
+    }
+    return EXIT_SUCCESS;
+}
+
+// +--------------------------------------------------------------------------+
+// | Bit copies
+// +--------------------------------------------------------------------------+
+
+typedef struct
+{
+    size_t length_bytes;
+    size_t src_offset_bits;
+    size_t dst_offset_bits;
+} CopyArgs;
+
+static uint8_t g_src[4097];
+static uint8_t g_dst[4097];
+
+static void benchCopyBits(const void* const arg, const size_t iterations)
+{
+    const CopyArgs* const args = (const CopyArgs*) arg;
+    for (size_t i = 0U; i < iterations; ++i)
+    {
+        nunavutCopyBits(g_dst, args->dst_offset_bits, args->length_bytes * 8U, g_src, args->src_offset_bits);
+        g_sink += g_dst[i % args->length_bytes];
+    }
+}
+
+// +--------------------------------------------------------------------------+
+// | Scalars
+// +--------------------------------------------------------------------------+
+
+#define SCALAR_COUNT 64U
+
+typedef struct
+{
+    uint8_t len_bits;
+    size_t offset_bits;
+} ScalarArgs;
+
+static uint8_t g_scalars[(SCALAR_COUNT * 8U) + 1U];
+
+#define DEFINE_GET_BENCHMARK(width)                                                                         \
+    static void benchGetU##width(const void* const arg, const size_t iterations)                           \
+    {                                                                                                       \
+        const ScalarArgs* const args = (const ScalarArgs*) arg;                                             \
+        uint64_t acc                 = 0U;                                                                  \
+        for (size_t i = 0U; i < iterations; ++i)                                                            \
+        {                                                                                                   \
+            for (size_t k = 0U; k < SCALAR_COUNT; ++k)                                                      \
+            {                                                                                               \
+                acc += nunavutGetU##width(g_scalars,                                                        \
+                                          sizeof(g_scalars),                                                \
+                                          args->offset_bits + (k * args->len_bits),                         \
+                                          args->len_bits);                                                  \
+            }                                                                                               \
+        }                                                                                                   \
+        g_sink += acc;                                                                                      \
+    }
+
+DEFINE_GET_BENCHMARK(8)
+DEFINE_GET_BENCHMARK(16)
+DEFINE_GET_BENCHMARK(32)
+DEFINE_GET_BENCHMARK(64)
+
+static void benchSetUxx(const void* const arg, const size_t iterations)
+{
+    const ScalarArgs* const args = (const ScalarArgs*) arg;
+    for (size_t i = 0U; i < iterations; ++i)
+    {
+        for (size_t k = 0U; k < SCALAR_COUNT; ++k)
+        {
+            g_sink += (uint64_t) (int64_t) nunavutSetUxx(g_scalars,
+                                                         sizeof(g_scalars),
+                                                         args->offset_bits + (k * args->len_bits),
+                                                         0x0123456789ABCDEFULL ^ k,
+                                                         args->len_bits);
+        }
+    }
+}
+
+// +--------------------------------------------------------------------------+
+// | float16
+// +--------------------------------------------------------------------------+
+
+#define FLOAT16_COUNT 256U
+
+static float g_floats[FLOAT16_COUNT];
+
+static void benchFloat16Pack(const void* const arg, const size_t iterations)
+{
+    (void) arg;
+    uint64_t acc = 0U;
+    for (size_t i = 0U; i < iterations; ++i)
+    {
+        for (size_t k = 0U; k < FLOAT16_COUNT; ++k)
+        {
+            acc += nunavutFloat16Pack(g_floats[k]);
+        }
+    }
+    g_sink += acc;
+}
+
+static void benchFloat16Unpack(const void* const arg, const size_t iterations)
+{
+    (void) arg;
+    float acc = 0.0F;
+    for (size_t i = 0U; i < iterations; ++i)
+    {
+        for (size_t k = 0U; k < FLOAT16_COUNT; ++k)
+        {
+            acc += nunavutFloat16Unpack((uint16_t) (k * 97U));
+        }
+    }
+    g_sink += (uint64_t) (acc != acc);
+}
+
+// +--------------------------------------------------------------------------+
+// | Generated types
+// +--------------------------------------------------------------------------+
+
+// Benchmarks of a message type: serialize a prototype, or deserialize its serialized form.
+#define DEFINE_TYPE_BENCHMARKS(type)                                                                           \
+    static type    g_##type;                                                                                   \
+    static uint8_t g_##type##_buffer[type##_SERIALIZATION_BUFFER_SIZE_BYTES_ + 1U];                             \
+    static size_t  g_##type##_size;                                                                            \
+    static void    benchSerialize_##type(const void* const arg, const size_t iterations)                       \
+    {                                                                                                          \
+        (void) arg;                                                                                            \
+        for (size_t i = 0U; i < iterations; ++i)                                                               \
+        {                                                                                                      \
+            size_t size_bytes = sizeof(g_##type##_buffer);                                                     \
+            g_sink += (uint64_t) (int64_t) type##_serialize_(&g_##type, g_##type##_buffer, &size_bytes);       \
+            g_sink += size_bytes;                                                                              \
+        }                                                                                                      \
+    }                                                                                                          \
+    static void benchDeserialize_##type(const void* const arg, const size_t iterations)                        \
+    {                                                                                                          \
+        (void) arg;                                                                                            \
+        type obj;                                                                                              \
+        for (size_t i = 0U; i < iterations; ++i)                                                               \
+        {                                                                                                      \
+            size_t size_bytes = g_##type##_size;                                                               \
+            g_sink += (uint64_t) (int64_t) type##_deserialize_(&obj, g_##type##_buffer, &size_bytes);          \
+            g_sink += size_bytes;                                                                              \
+        }                                                                                                      \
+    }                                                                                                          \
+    static void addTypeBenchmarks_##type(const char* const label)                                              \
+    {                                                                                                          \
+        g_##type##_size = sizeof(g_##type##_buffer);                                                           \
+        if (type##_serialize_(&g_##type, g_##type##_buffer, &g_##type##_size) < 0)                             \
+        {                                                                                                      \
+            (void) fprintf(stderr, "Cannot serialize %s\n", label);                                            \
+            exit(EXIT_FAILURE);                                                                                \
+        }                                                                                                      \
+        char name[96];                                                                                         \
+        (void) snprintf(name, sizeof(name), "BM_Serialize/%s", label);                                         \
+        Benchmark* bench           = addBenchmark(name, &benchSerialize_##type, NULL);                         \
+        bench->bytes_per_iteration = g_##type##_size;                                                          \
+        bench->items_per_iteration = 1U;                                                                       \
+        (void) snprintf(name, sizeof(name), "BM_Deserialize/%s", label);                                       \
+        bench                      = addBenchmark(name, &benchDeserialize_##type, NULL);                       \
+        bench->bytes_per_iteration = g_##type##_size;                                                          \
+        bench->items_per_iteration = 1U;                                                                       \
+    }
+
+DEFINE_TYPE_BENCHMARKS(regulated_basics_Struct__0_1)
+DEFINE_TYPE_BENCHMARKS(regulated_basics_Primitive_0_1)
+DEFINE_TYPE_BENCHMARKS(regulated_basics_PrimitiveArrayVariable_0_1)
+DEFINE_TYPE_BENCHMARKS(uavcan_node_Heartbeat_1_0)
+DEFINE_TYPE_BENCHMARKS(uavcan_node_GetInfo_Response_1_0)
+
+static void makePrototypes(void)
+{
+    regulated_basics_Struct__0_1* const st = &g_regulated_basics_Struct__0_1;
+    regulated_basics_Struct__0_1_initialize_(st);
+    st->boolean                    = true;
+    st->i10_4[0]                   = 0x1FF;
+    st->f16_le2.elements[0]        = -1.0F;
+    st->f16_le2.elements[1]        = 3.5F;
+    st->f16_le2.count              = 2U;
+    st->bytes_lt3.elements[0]      = 111U;
+    st->bytes_lt3.count            = 1U;
+    st->u2_le4.elements[0]         = 2U;
+    st->u2_le4.count               = 1U;
+    st->u16_2[0]                   = 0x1234U;
+    st->delimited_fix_le2.count    = 1U;
+    regulated_basics_DelimitedVariableSize_0_1_select_f16_(&st->delimited_var_2[0]);
+    st->delimited_var_2[0].f16 = 1.0F;
+    regulated_basics_DelimitedVariableSize_0_1_select_f64_(&st->delimited_var_2[1]);
+    st->delimited_var_2[1].f64 = -1e40;
+    st->aligned_bitpacked_le3.bitpacked[0] = 1U;
+    st->aligned_bitpacked_le3.count = 1U;
+
+    regulated_basics_Primitive_0_1* const pr = &g_regulated_basics_Primitive_0_1;
+    regulated_basics_Primitive_0_1_initialize_(pr);
+    pr->a_u64 = 0x0123456789ABCDEFULL;
+    pr->a_u32 = 0x01234567UL;
+    pr->a_f64 = 1.0 / 3.0;
+    pr->a_f16 = 2.5F;
+
+    regulated_basics_PrimitiveArrayVariable_0_1* const pa = &g_regulated_basics_PrimitiveArrayVariable_0_1;
+    regulated_basics_PrimitiveArrayVariable_0_1_initialize_(pa);
+    for (size_t i = 0U; i < regulated_basics_PrimitiveArrayVariable_0_1_CAPACITY; ++i)
+    {
+        pa->a_u64.elements[i] = i * 0x0101010101010101ULL;
+        pa->a_u7.elements[i]  = (uint8_t) i;
+        pa->a_f32.elements[i] = (float) i * 0.25F;
+        pa->a_f16.elements[i] = (float) i * 0.5F;
+    }
+    pa->a_u64.count = regulated_basics_PrimitiveArrayVariable_0_1_CAPACITY;
+    pa->a_u7.count  = regulated_basics_PrimitiveArrayVariable_0_1_CAPACITY;
+    pa->a_f32.count = regulated_basics_PrimitiveArrayVariable_0_1_CAPACITY;
+    pa->a_f16.count = regulated_basics_PrimitiveArrayVariable_0_1_CAPACITY;
+    pa->a_bool.bitpacked[0] = 0x05U;
+    pa->a_bool.count        = regulated_basics_PrimitiveArrayVariable_0_1_CAPACITY;
+
+    uavcan_node_Heartbeat_1_0* const hb = &g_uavcan_node_Heartbeat_1_0;
+    uavcan_node_Heartbeat_1_0_initialize_(hb);
+    hb->uptime                      = 123456U;
+    hb->health.value                = uavcan_node_Health_1_0_CAUTION;
+    hb->mode.value                  = uavcan_node_Mode_1_0_MAINTENANCE;
+    hb->vendor_specific_status_code = 0x5AU;
+
+    uavcan_node_GetInfo_Response_1_0* const gi = &g_uavcan_node_GetInfo_Response_1_0;
+    uavcan_node_GetInfo_Response_1_0_initialize_(gi);
+    gi->protocol_version.major   = 1U;
+    gi->software_vcs_revision_id = 0xDEADBEEFCAFEULL;
+    for (size_t i = 0U; i < sizeof(gi->unique_id); ++i)
+    {
+        gi->unique_id[i] = (uint8_t) i;
+    }
+    static const char name[] = "org.opencyphal.nunavut.bench";
+    (void) memcpy(gi->name.elements, name, sizeof(name) - 1U);
+    gi->name.count                       = sizeof(name) - 1U;
+    gi->software_image_crc.elements[0]   = 0x0123456789ABCDEFULL;
+    gi->software_image_crc.count         = 1U;
+}
+
+// +--------------------------------------------------------------------------+
+// | Registration
+// +--------------------------------------------------------------------------+
+
+static CopyArgs   g_copy_args[16];
+static ScalarArgs g_get_args[16];
+static ScalarArgs g_set_args[16];
+
+int main(const int argc, char* argv[])
+{
+    for (size_t i = 0U; i < sizeof(g_src); ++i)
+    {
+        g_src[i] = (uint8_t) (i * 37U);
+    }
+    for (size_t i = 0U; i < sizeof(g_scalars); ++i)
+    {
+        g_scalars[i] = (uint8_t) (i * 37U);
+    }
+    for (size_t i = 0U; i < FLOAT16_COUNT; ++i)
+    {
+        g_floats[i] = ((float) i - 128.0F) * 3.3F;
+    }
+
+    static const size_t copy_bytes[] = {8U, 64U, 512U, 4096U};
+    size_t              n            = 0U;
+    for (size_t b = 0U; b < 4U; ++b)
+    {
+        for (size_t src_off = 0U; src_off <= 3U; src_off += 3U)
+        {
+            for (size_t dst_off = 0U; dst_off <= 5U; dst_off += 5U)
+            {
+                CopyArgs* const args = &g_copy_args[n++];
+                args->length_bytes    = copy_bytes[b];
+                args->src_offset_bits = src_off;
+                args->dst_offset_bits = dst_off;
+                char name[96];
+                (void) snprintf(name,
+                                sizeof(name),
+                                "BM_CopyTo/bytes:%zu/src_off:%zu/dst_off:%zu",
+                                copy_bytes[b],
+                                src_off,
+                                dst_off);
+                addBenchmark(name, &benchCopyBits, args)->bytes_per_iteration = copy_bytes[b];
+            }
+        }
+    }
+
+    static const struct
+    {
+        const char*   name;
+        BenchFunction function;
+        uint8_t       len_bits[2];
+    } getters[] = {
+        {"BM_GetU8", &benchGetU8, {3U, 8U}},
+        {"BM_GetU16", &benchGetU16, {12U, 16U}},
+        {"BM_GetU32", &benchGetU32, {24U, 32U}},
+        {"BM_GetU64", &benchGetU64, {48U, 64U}},
+    };
+    n = 0U;
+    for (size_t g = 0U; g < 4U; ++g)
+    {
+        for (size_t off = 0U; off <= 3U; off += 3U)
+        {
+            for (size_t l = 0U; l < 2U; ++l)
+            {
+                ScalarArgs* const args = &g_get_args[n++];
+                args->len_bits         = getters[g].len_bits[l];
+                args->offset_bits      = off;
+                char name[96];
+                (void) snprintf(name, sizeof(name), "%s/bits:%u/off:%zu", getters[g].name, args->len_bits, off);
+                addBenchmark(name, getters[g].function, args)->items_per_iteration = SCALAR_COUNT;
+            }
+        }
+    }
+
+    static const uint8_t set_bits[] = {3U, 8U, 12U, 16U, 24U, 32U, 48U, 64U};
+    n                               = 0U;
+    for (size_t off = 0U; off <= 3U; off += 3U)
+    {
+        for (size_t l = 0U; l < sizeof(set_bits); ++l)
+        {
+            ScalarArgs* const args = &g_set_args[n++];
+            args->len_bits         = set_bits[l];
+            args->offset_bits      = off;
+            char name[96];
+            (void) snprintf(name, sizeof(name), "BM_SetUxx/bits:%u/off:%zu", args->len_bits, off);
+            addBenchmark(name, &benchSetUxx, args)->items_per_iteration = SCALAR_COUNT;
+        }
+    }
+
+    addBenchmark("BM_Float16Pack", &benchFloat16Pack, NULL)->items_per_iteration     = FLOAT16_COUNT;
+    addBenchmark("BM_Float16Unpack", &benchFloat16Unpack, NULL)->items_per_iteration = FLOAT16_COUNT;
+
+    makePrototypes();
+    addTypeBenchmarks_regulated_basics_Struct__0_1("Struct__0_1");
+    addTypeBenchmarks_regulated_basics_Primitive_0_1("Primitive_0_1");
+    addTypeBenchmarks_regulated_basics_PrimitiveArrayVariable_0_1("PrimitiveArrayVariable_0_1");
+    addTypeBenchmarks_uavcan_node_Heartbeat_1_0("Heartbeat_1_0");
+    addTypeBenchmarks_uavcan_node_GetInfo_Response_1_0("GetInfo_Response_1_0");
+
+    return runBenchmarks(argc, argv);
+}
@@ -63,6 +63,38 @@ static void testNunavutCopyBitsWithUnalignedOffset(void)
     TEST_ASSERT_EQUAL_HEX8(0x54, dst[0]);
 }
 
+/// The word-at-a-time engine must produce the same output as the reference bytewise engine bit for bit, including
+/// the destination bits outside of the copied range.
+static void testNunavutCopyBitsWordwiseMatchesBytewise(void)
+{
+    static const size_t lengths[] = { 1, 7, 8, 9, 63, 64, 65, 127, 128, 129, 191, 192, 193, 255, 256, 300 };
+    uint8_t src[64];
+    for (size_t i = 0; i < sizeof(src); ++i)
+    {
+        src[i] = (uint8_t) ((i * 37U) + 11U);
+    }
+    for (size_t src_off = 0; src_off < 16; ++src_off)
+    {
+        for (size_t dst_off = 0; dst_off < 16; ++dst_off)
+        {
+            for (size_t i = 0; i < sizeof(lengths) / sizeof(lengths[0]); ++i)
+            {
+                uint8_t expected[sizeof(src)];
+                uint8_t wordwise[sizeof(src)];
+                uint8_t selected[sizeof(src)];
+                memset(expected, 0xA5, sizeof(expected));
+                memset(wordwise, 0xA5, sizeof(wordwise));
+                memset(selected, 0xA5, sizeof(selected));
+                nunavutCopyBitsBytewise(expected, dst_off, lengths[i], src, src_off);
+                nunavutCopyBitsWordwise(wordwise, dst_off, lengths[i], src, src_off);
+                nunavutCopyBits(selected, dst_off, lengths[i], src, src_off);
+                TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, wordwise, sizeof(expected));
+                TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, selected, sizeof(expected));
+            }
+        }
+    }
+}
+
 // +--------------------------------------------------------------------------+
 // | nunavutSaturateBufferFragmentBitLength
 // +--------------------------------------------------------------------------+
@@ -283,6 +315,46 @@ static void testNunavutGetU64_tooSmall(void)
     TEST_ASSERT_EQUAL_HEX64(0x0055555555555555, nunavutGetU64(data, sizeof(data), 9, 64U));
 }
 
+static void testNunavutGetUxxMatchesGetBits(void)
+{
+    // Every offset and length near both ends of the buffer, covering the 64-bit window, the byte-aligned, and the
+    // implicit zero extension paths of the getters. nunavutGetBits() is the reference.
+    uint8_t data[24];
+    for (size_t i = 0; i < sizeof(data); ++i)
+    {
+        data[i] = (uint8_t) ((i * 73U) + 29U);
+    }
+    for (size_t size = 0; size <= sizeof(data); ++size)
+    {
+        for (size_t off = 0; off < (size * 8U) + 16U; ++off)
+        {
+            for (uint8_t len = 1; len <= 64U; ++len)
+            {
+                uint8_t expected[8];
+                memset(expected, 0, sizeof(expected));
+                nunavutGetBits(expected, data, size, off, len);
+                const uint64_t reference = ((uint64_t) expected[0]) | (((uint64_t) expected[1]) << 8U) |
+                                           (((uint64_t) expected[2]) << 16U) | (((uint64_t) expected[3]) << 24U) |
+                                           (((uint64_t) expected[4]) << 32U) | (((uint64_t) expected[5]) << 40U) |
+                                           (((uint64_t) expected[6]) << 48U) | (((uint64_t) expected[7]) << 56U);
+                TEST_ASSERT_EQUAL_HEX64(reference, nunavutGetU64(data, size, off, len));
+                if (len <= 32U)
+                {
+                    TEST_ASSERT_EQUAL_HEX32((uint32_t) reference, nunavutGetU32(data, size, off, len));
+                }
+                if (len <= 16U)
+                {
+                    TEST_ASSERT_EQUAL_HEX16((uint16_t) reference, nunavutGetU16(data, size, off, len));
+                }
+                if (len <= 8U)
+                {
+                    TEST_ASSERT_EQUAL_HEX8((uint8_t) reference, nunavutGetU8(data, size, off, len));
+                }
+            }
+        }
+    }
+}
+
 // +--------------------------------------------------------------------------+
 // | nunavutGetI8
 // +--------------------------------------------------------------------------+
@@ -764,6 +836,7 @@ int main(void)
     RUN_TEST(testNunavutCopyBits);
     RUN_TEST(testNunavutCopyBitsWithAlignedOffset);
     RUN_TEST(testNunavutCopyBitsWithUnalignedOffset);
+    RUN_TEST(testNunavutCopyBitsWordwiseMatchesBytewise);
     RUN_TEST(testNunavutSaturateBufferFragmentBitLength);
     RUN_TEST(testNunavutGetBits);
     RUN_TEST(testNunavutSetIxx_neg1);
@@ -781,6 +854,7 @@ int main(void)
     RUN_TEST(testNunavutGetU32_tooSmall);
     RUN_TEST(testNunavutGetU64);
     RUN_TEST(testNunavutGetU64_tooSmall);
+    RUN_TEST(testNunavutGetUxxMatchesGetBits);
     RUN_TEST(testNunavutGetI8);
     RUN_TEST(testNunavutGetI8_tooSmall);
     RUN_TEST(testNunavutGetI8_tooSmallAndNegative);
@@ -187,6 +187,78 @@ function(define_native_unit_test
 endfunction()
 
 
+#
+# function: define_native_benchmark - creates an executable target that is not part
+# of the "all" target to build a benchmark binary for the given source.
+#
+# param: ARG_FRAMEWORK string - "benchmark" to link against Google Benchmark or
+#                               "none" for benchmarks that carry their own harness.
+# param: ARG_BENCH_NAME string - The name to give the benchmark binary.
+# param: ARG_BENCH_SOURCE List[path] - A list of source files to compile into
+#                               the benchmark binary.
+# param: ARG_OUTDIR path - A path to output benchmark binaries and results under.
+# param: ARG_EXTRA_COMPILE_FLAGS string - Additional compile arguments to set for
+#                        the ARG_BENCH_SOURCE files in addition to the arguments
+#                        used for the current toolchain and language.
+# param: ... List[str] - Zero to many targets that generate types under test.
+#
+function(define_native_benchmark
+         ARG_FRAMEWORK
+         ARG_BENCH_NAME
+         ARG_BENCH_SOURCE
+         ARG_OUTDIR
+         ARG_EXTRA_COMPILE_FLAGS)
+
+    add_executable(${ARG_BENCH_NAME} EXCLUDE_FROM_ALL ${ARG_BENCH_SOURCE})
+
+    if(NOT "${ARG_EXTRA_COMPILE_FLAGS}" STREQUAL "")
+        string(REPLACE ";" " " LOCAL_${ARG_BENCH_NAME}_COMPILE_FLAGS "${ARG_EXTRA_COMPILE_FLAGS}")
+        set_source_files_properties(${ARG_BENCH_SOURCE}
+                                    PROPERTIES
+                                    COMPILE_FLAGS
+                                        ${LOCAL_${ARG_BENCH_NAME}_COMPILE_FLAGS}
+        )
+    endif()
+
+    set(LOCAL_${ARG_BENCH_NAME}_LINK_LIBS "")
+
+    if (${ARGC} GREATER 5)
+        MATH(EXPR ARG_N_LAST "${ARGC}-1")
+        foreach(ARG_N RANGE 5 ${ARG_N_LAST})
+            list(APPEND LOCAL_${ARG_BENCH_NAME}_LINK_LIBS ${ARGV${ARG_N}})
+        endforeach(ARG_N)
+    endif()
+
+    target_link_libraries(${ARG_BENCH_NAME} ${LOCAL_${ARG_BENCH_NAME}_LINK_LIBS} "${ARG_EXTRA_COMPILE_FLAGS}")
+
+    if (${ARG_FRAMEWORK} STREQUAL "benchmark")
+        target_link_libraries(${ARG_BENCH_NAME} benchmark::benchmark)
+    elseif (NOT ${ARG_FRAMEWORK} STREQUAL "none")
+        message(FATAL_ERROR "${ARG_FRAMEWORK} isn't a supported benchmark framework. Currently we support benchmark and none.")
+    endif()
+
+    set_target_properties(${ARG_BENCH_NAME}
+                          PROPERTIES
+                          RUNTIME_OUTPUT_DIRECTORY "${ARG_OUTDIR}"
+    )
+
+    add_custom_target(
+        run_${ARG_BENCH_NAME}
+        COMMAND
+            ${ARG_OUTDIR}/${ARG_BENCH_NAME}
+                --benchmark_out=${ARG_OUTDIR}/${ARG_BENCH_NAME}.json
+                --benchmark_out_format=json
+        DEPENDS
+            ${ARG_BENCH_NAME}
+        BYPRODUCTS
+            ${ARG_OUTDIR}/${ARG_BENCH_NAME}.json
+        COMMENT
+            "Running ${ARG_BENCH_NAME}. Results are written to ${ARG_OUTDIR}/${ARG_BENCH_NAME}.json"
+    )
+
+endfunction()
+
+
 #
 # function: define_native_test_run - creates a makefile target that will build and
 # run individual unit tests.
@@ -0,0 +1,437 @@
+/*
+ * Copyright (c) 2023 UAVCAN Development Team.
+ * This software is distributed under the terms of the MIT License.
+ *
+ * Throughput of the serialization support library and of generated types. Run with
+ * --benchmark_out=<file> --benchmark_out_format=json to get machine-readable results; the run_bench_serialization
+ * target does that.
+ *
+ * The generated types are timed with both backends on the same messages: BM_Serialize/<type> runs the C++ code and
+ * BM_SerializeC/<type> the C code, so a change to bitspan::copyTo() or nunavutCopyBits() shows up in both.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "nunavut/support/serialization.hpp"
+#include "regulated/basics/Struct__0_1.hpp"
+#include "regulated/basics/Primitive_0_1.hpp"
+#include "regulated/basics/PrimitiveArrayVariable_0_1.hpp"
+#include "uavcan/node/Heartbeat_1_0.hpp"
+#include "uavcan/node/GetInfo_1_0.hpp"
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wold-style-cast"
+#include "regulated/basics/Struct__0_1.h"
+#include "regulated/basics/Primitive_0_1.h"
+#include "regulated/basics/PrimitiveArrayVariable_0_1.h"
+#include "uavcan/node/Heartbeat_1_0.h"
+#include "uavcan/node/GetInfo_1_0.h"
+#pragma GCC diagnostic pop
+
+namespace
+{
+
+// +--------------------------------------------------------------------------+
+// | Bit copies
+// +--------------------------------------------------------------------------+
+
+/// Arguments: the number of bytes copied, the source offset and the destination offset, in bits.
+void BM_CopyTo(benchmark::State& state)
+{
+    const auto length_bytes = static_cast<std::size_t>(state.range(0));
+    const auto src_offset   = static_cast<std::size_t>(state.range(1));
+    const auto dst_offset   = static_cast<std::size_t>(state.range(2));
+    std::vector<uint8_t> src(length_bytes + 1U, 0xA5U);
+    std::vector<uint8_t> dst(length_bytes + 1U, 0x00U);
+    for (auto _ : state)
+    {
+        nunavut::support::const_bitspan{src.data(), src.size(), src_offset}.copyTo(
+            nunavut::support::bitspan{dst.data(), dst.size(), dst_offset}, length_bytes * 8U);
+        benchmark::DoNotOptimize(dst.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(length_bytes));
+}
+BENCHMARK(BM_CopyTo)
+    ->ArgNames({"bytes", "src_off", "dst_off"})
+    ->ArgsProduct({{8, 64, 512, 4096}, {0, 3}, {0, 5}});
+
+// +--------------------------------------------------------------------------+
+// | Scalars
+// +--------------------------------------------------------------------------+
+
+constexpr std::size_t ScalarCount = 64U;
+
+/// Arguments: the bit length of each value and the offset of the first one. The values are packed back to back.
+template <typename Getter>
+void runGetter(benchmark::State& state, Getter getter)
+{
+    const auto len_bits = static_cast<uint8_t>(state.range(0));
+    const auto offset   = static_cast<std::size_t>(state.range(1));
+    std::array<uint8_t, ScalarCount * 8U + 1U> buffer{};
+    for (std::size_t i = 0U; i < buffer.size(); ++i)
+    {
+        buffer[i] = static_cast<uint8_t>(i * 37U);
+    }
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0U; i < ScalarCount; ++i)
+        {
+            const nunavut::support::const_bitspan sp{buffer.data(), buffer.size(), offset + (i * len_bits)};
+            benchmark::DoNotOptimize(getter(sp, len_bits));
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(ScalarCount));
+}
+
+void BM_GetU8(benchmark::State& state)
+{
+    runGetter(state, [](nunavut::support::const_bitspan sp, uint8_t len) { return sp.getU8(len); });
+}
+void BM_GetU16(benchmark::State& state)
+{
+    runGetter(state, [](nunavut::support::const_bitspan sp, uint8_t len) { return sp.getU16(len); });
+}
+void BM_GetU32(benchmark::State& state)
+{
+    runGetter(state, [](nunavut::support::const_bitspan sp, uint8_t len) { return sp.getU32(len); });
+}
+void BM_GetU64(benchmark::State& state)
+{
+    runGetter(state, [](nunavut::support::const_bitspan sp, uint8_t len) { return sp.getU64(len); });
+}
+BENCHMARK(BM_GetU8)->ArgNames({"bits", "off"})->ArgsProduct({{3, 8}, {0, 3}});
+BENCHMARK(BM_GetU16)->ArgNames({"bits", "off"})->ArgsProduct({{12, 16}, {0, 3}});
+BENCHMARK(BM_GetU32)->ArgNames({"bits", "off"})->ArgsProduct({{24, 32}, {0, 3}});
+BENCHMARK(BM_GetU64)->ArgNames({"bits", "off"})->ArgsProduct({{48, 64}, {0, 3}});
+
+/// Arguments: the bit length of each value and the offset of the first one. The values are packed back to back.
+void BM_SetUxx(benchmark::State& state)
+{
+    const auto len_bits = static_cast<uint8_t>(state.range(0));
+    const auto offset   = static_cast<std::size_t>(state.range(1));
+    std::array<uint8_t, ScalarCount * 8U + 1U> buffer{};
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0U; i < ScalarCount; ++i)
+        {
+            nunavut::support::bitspan sp{buffer.data(), buffer.size(), offset + (i * len_bits)};
+            benchmark::DoNotOptimize(sp.setUxx(0x0123456789ABCDEFULL ^ i, len_bits));
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(ScalarCount));
+}
+BENCHMARK(BM_SetUxx)->ArgNames({"bits", "off"})->ArgsProduct({{3, 8, 12, 16, 24, 32, 48, 64}, {0, 3}});
+
+// +--------------------------------------------------------------------------+
+// | float16
+// +--------------------------------------------------------------------------+
+
+constexpr std::size_t Float16Count = 256U;
+
+std::array<float, Float16Count> makeFloats()
+{
+    std::array<float, Float16Count> values{};
+    for (std::size_t i = 0U; i < values.size(); ++i)
+    {
+        values[i] = (static_cast<float>(i) - 128.0F) * 3.3F;
+    }
+    return values;
+}
+
+void BM_Float16Pack(benchmark::State& state)
+{
+    const auto values = makeFloats();
+    for (auto _ : state)
+    {
+        for (const float value : values)
+        {
+            benchmark::DoNotOptimize(nunavut::support::float16Pack(value));
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(Float16Count));
+}
+BENCHMARK(BM_Float16Pack);
+
+void BM_Float16Unpack(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        for (uint16_t i = 0U; i < Float16Count; ++i)
+        {
+            benchmark::DoNotOptimize(nunavut::support::float16Unpack(static_cast<uint16_t>(i * 97U)));
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(Float16Count));
+}
+BENCHMARK(BM_Float16Unpack);
+
+void BM_Float16PackMany(benchmark::State& state)
+{
+    const auto values = makeFloats();
+    std::array<uint16_t, Float16Count> packed{};
+    for (auto _ : state)
+    {
+        nunavut::support::float16PackMany<true>(values.data(), packed.data(), values.size());
+        benchmark::DoNotOptimize(packed.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(Float16Count));
+}
+BENCHMARK(BM_Float16PackMany);
+
+void BM_Float16UnpackMany(benchmark::State& state)
+{
+    std::array<uint16_t, Float16Count> packed{};
+    for (std::size_t i = 0U; i < packed.size(); ++i)
+    {
+        packed[i] = static_cast<uint16_t>(i * 97U);
+    }
+    std::array<float, Float16Count> values{};
+    for (auto _ : state)
+    {
+        nunavut::support::float16UnpackMany(packed.data(), values.data(), packed.size());
+        benchmark::DoNotOptimize(values.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(Float16Count));
+}
+BENCHMARK(BM_Float16UnpackMany);
+
+// +--------------------------------------------------------------------------+
+// | Generated types
+// +--------------------------------------------------------------------------+
+
+regulated::basics::Struct__0_1 makeStruct()
+{
+    regulated::basics::Struct__0_1 obj{};
+    obj.boolean = true;
+    obj.i10_4[0] = 0x1FF;
+    obj.f16_le2.push_back(-1.0F);
+    obj.f16_le2.push_back(3.5F);
+    obj.bytes_lt3.push_back(111);
+    obj.u2_le4.push_back(2);
+    obj.u16_2[0] = 0x1234;
+    obj.delimited_fix_le2.push_back(regulated::basics::DelimitedFixedSize_0_1{});
+    obj.delimited_var_2[0].set_f16(1.0F);
+    obj.delimited_var_2[1].set_f64(-1e40);
+    obj.aligned_bitpacked_le3.push_back(true);
+    return obj;
+}
+
+regulated::basics::Primitive_0_1 makePrimitive()
+{
+    regulated::basics::Primitive_0_1 obj{};
+    obj.a_u64 = 0x0123456789ABCDEFULL;
+    obj.a_u32 = 0x01234567UL;
+    obj.a_f64 = 1.0 / 3.0;
+    obj.a_f16 = 2.5F;
+    return obj;
+}
+
+regulated::basics::PrimitiveArrayVariable_0_1 makePrimitiveArrayVariable()
+{
+    regulated::basics::PrimitiveArrayVariable_0_1 obj{};
+    for (std::size_t i = 0U; i < regulated::basics::PrimitiveArrayVariable_0_1::CAPACITY; ++i)
+    {
+        obj.a_u64.push_back(i * 0x0101010101010101ULL);
+        obj.a_u7.push_back(static_cast<uint8_t>(i));
+        obj.a_f32.push_back(static_cast<float>(i) * 0.25F);
+        obj.a_f16.push_back(static_cast<float>(i) * 0.5F);
+        obj.a_bool.push_back((i % 2U) == 0U);
+    }
+    return obj;
+}
+
+uavcan::node::Heartbeat_1_0 makeHeartbeat()
+{
+    uavcan::node::Heartbeat_1_0 obj{};
+    obj.uptime = 123456U;
+    obj.health.value = uavcan::node::Health_1_0::CAUTION;
+    obj.mode.value = uavcan::node::Mode_1_0::MAINTENANCE;
+    obj.vendor_specific_status_code = 0x5AU;
+    return obj;
+}
+
+uavcan::node::GetInfo::Response_1_0 makeGetInfoResponse()
+{
+    uavcan::node::GetInfo::Response_1_0 obj{};
+    obj.protocol_version.major = 1U;
+    obj.software_vcs_revision_id = 0xDEADBEEFCAFEULL;
+    for (std::size_t i = 0U; i < obj.unique_id.size(); ++i)
+    {
+        obj.unique_id[i] = static_cast<uint8_t>(i);
+    }
+    const char name[] = "org.opencyphal.nunavut.bench";
+    for (std::size_t i = 0U; i + 1U < sizeof(name); ++i)
+    {
+        obj.name.push_back(static_cast<uint8_t>(name[i]));
+    }
+    obj.software_image_crc.push_back(0x0123456789ABCDEFULL);
+    return obj;
+}
+
+template <typename T>
+void BM_Serialize(benchmark::State& state, const T prototype)
+{
+    std::array<uint8_t, T::SERIALIZATION_BUFFER_SIZE_BYTES> buffer{};
+    std::size_t size_bytes = 0U;
+    for (auto _ : state)
+    {
+        const auto result = prototype.serialize({buffer.data(), buffer.size()});
+        if (!result)
+        {
+            state.SkipWithError("serialize() failed");
+            break;
+        }
+        size_bytes = result.value();
+        benchmark::DoNotOptimize(buffer.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(size_bytes));
+}
+
+template <typename T>
+void BM_Deserialize(benchmark::State& state, const T prototype)
+{
+    std::array<uint8_t, T::SERIALIZATION_BUFFER_SIZE_BYTES> buffer{};
+    const auto serialized = prototype.serialize({buffer.data(), buffer.size()});
+    if (!serialized)
+    {
+        state.SkipWithError("serialize() failed");
+        return;
+    }
+    T obj{};
+    for (auto _ : state)
+    {
+        const auto result = obj.deserialize({buffer.data(), serialized.value()});
+        benchmark::DoNotOptimize(result);
+        benchmark::DoNotOptimize(obj);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(serialized.value()));
+}
+
+// +--------------------------------------------------------------------------+
+// | Generated types, C backend
+// +--------------------------------------------------------------------------+
+
+/// The C type and functions generated from the same definition as the C++ type T.
+template <typename T>
+struct CBackend;
+
+#define NUNAVUT_C_BACKEND(cpp_type, c_type)                                                                  \
+    template <>                                                                                              \
+    struct CBackend<cpp_type>                                                                                \
+    {                                                                                                        \
+        using C = c_type;                                                                                    \
+        static int8_t serialize(const C& obj, uint8_t* const buffer, std::size_t* const inout_size)          \
+        {                                                                                                    \
+            return c_type##_serialize_(&obj, buffer, inout_size);                                            \
+        }                                                                                                    \
+        static int8_t deserialize(C& obj, const uint8_t* const buffer, std::size_t* const inout_size)        \
+        {                                                                                                    \
+            return c_type##_deserialize_(&obj, buffer, inout_size);                                          \
+        }                                                                                                    \
+    }
+
+NUNAVUT_C_BACKEND(regulated::basics::Struct__0_1, regulated_basics_Struct__0_1);
+NUNAVUT_C_BACKEND(regulated::basics::Primitive_0_1, regulated_basics_Primitive_0_1);
+NUNAVUT_C_BACKEND(regulated::basics::PrimitiveArrayVariable_0_1, regulated_basics_PrimitiveArrayVariable_0_1);
+NUNAVUT_C_BACKEND(uavcan::node::Heartbeat_1_0, uavcan_node_Heartbeat_1_0);
+NUNAVUT_C_BACKEND(uavcan::node::GetInfo::Response_1_0, uavcan_node_GetInfo_Response_1_0);
+
+/// Serializes @p prototype with the C++ code into @p buffer and decodes it with the C code into @p obj.
+/// @return The size of the serialized representation, or zero on failure.
+template <typename T, std::size_t N>
+std::size_t toC(const T& prototype, std::array<uint8_t, N>& buffer, typename CBackend<T>::C& obj)
+{
+    const auto serialized = prototype.serialize({buffer.data(), buffer.size()});
+    if (!serialized)
+    {
+        return 0U;
+    }
+    std::size_t size_bytes = serialized.value();
+    return (CBackend<T>::deserialize(obj, buffer.data(), &size_bytes) < 0) ? 0U : serialized.value();
+}
+
+template <typename T>
+void BM_SerializeC(benchmark::State& state, const T prototype)
+{
+    std::array<uint8_t, T::SERIALIZATION_BUFFER_SIZE_BYTES> buffer{};
+    const auto obj = std::make_unique<typename CBackend<T>::C>();
+    if (toC(prototype, buffer, *obj) == 0U)
+    {
+        state.SkipWithError("conversion to the C type failed");
+        return;
+    }
+    std::size_t size_bytes = 0U;
+    for (auto _ : state)
+    {
+        size_bytes = buffer.size();
+        if (CBackend<T>::serialize(*obj, buffer.data(), &size_bytes) < 0)
+        {
+            state.SkipWithError("serialize_() failed");
+            break;
+        }
+        benchmark::DoNotOptimize(buffer.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(size_bytes));
+}
+
+template <typename T>
+void BM_DeserializeC(benchmark::State& state, const T prototype)
+{
+    std::array<uint8_t, T::SERIALIZATION_BUFFER_SIZE_BYTES> buffer{};
+    const auto obj = std::make_unique<typename CBackend<T>::C>();
+    const std::size_t serialized = toC(prototype, buffer, *obj);
+    if (serialized == 0U)
+    {
+        state.SkipWithError("conversion to the C type failed");
+        return;
+    }
+    for (auto _ : state)
+    {
+        std::size_t size_bytes = serialized;
+        const int8_t result = CBackend<T>::deserialize(*obj, buffer.data(), &size_bytes);
+        benchmark::DoNotOptimize(result);
+        benchmark::DoNotOptimize(*obj);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(serialized));
+}
+
+BENCHMARK_CAPTURE(BM_Serialize, Struct__0_1, makeStruct());
+BENCHMARK_CAPTURE(BM_Deserialize, Struct__0_1, makeStruct());
+BENCHMARK_CAPTURE(BM_Serialize, Primitive_0_1, makePrimitive());
+BENCHMARK_CAPTURE(BM_Deserialize, Primitive_0_1, makePrimitive());
+BENCHMARK_CAPTURE(BM_Serialize, PrimitiveArrayVariable_0_1, makePrimitiveArrayVariable());
+BENCHMARK_CAPTURE(BM_Deserialize, PrimitiveArrayVariable_0_1, makePrimitiveArrayVariable());
+BENCHMARK_CAPTURE(BM_Serialize, Heartbeat_1_0, makeHeartbeat());
+BENCHMARK_CAPTURE(BM_Deserialize, Heartbeat_1_0, makeHeartbeat());
+BENCHMARK_CAPTURE(BM_Serialize, GetInfo_Response_1_0, makeGetInfoResponse());
+BENCHMARK_CAPTURE(BM_Deserialize, GetInfo_Response_1_0, makeGetInfoResponse());
+BENCHMARK_CAPTURE(BM_SerializeC, Struct__0_1, makeStruct());
+BENCHMARK_CAPTURE(BM_DeserializeC, Struct__0_1, makeStruct());
+BENCHMARK_CAPTURE(BM_SerializeC, Primitive_0_1, makePrimitive());
+BENCHMARK_CAPTURE(BM_DeserializeC, Primitive_0_1, makePrimitive());
+BENCHMARK_CAPTURE(BM_SerializeC, PrimitiveArrayVariable_0_1, makePrimitiveArrayVariable());
+BENCHMARK_CAPTURE(BM_DeserializeC, PrimitiveArrayVariable_0_1, makePrimitiveArrayVariable());
+BENCHMARK_CAPTURE(BM_SerializeC, Heartbeat_1_0, makeHeartbeat());
+BENCHMARK_CAPTURE(BM_DeserializeC, Heartbeat_1_0, makeHeartbeat());
+BENCHMARK_CAPTURE(BM_SerializeC, GetInfo_Response_1_0, makeGetInfoResponse());
+BENCHMARK_CAPTURE(BM_DeserializeC, GetInfo_Response_1_0, makeGetInfoResponse());
+
+}  // namespace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) 2023 UAVCAN Development Team.
+ * This software is distributed under the terms of the MIT License.
+ *
+ * The NUNAVUT_SUPPORT_TRACER of test_serialization_tracing. The tracer has to be the same in every translation unit,
+ * the generated source files included, so the build puts this header ahead of each of them (-include).
+ */
+#ifndef NUNAVUT_VERIFICATION_COUNTING_TRACER_HPP_INCLUDED
+#define NUNAVUT_VERIFICATION_COUNTING_TRACER_HPP_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+
+namespace nunavut
+{
+namespace support
+{
+enum class TraceOperation;
+struct TraceRecord;
+}  // namespace support
+}  // namespace nunavut
+
+/// Keeps what it is told; see test_serialization_tracing.cpp.
+struct CountingTracer final
+{
+    static std::uint64_t now() noexcept;
+    static void on_begin(nunavut::support::TraceOperation operation, const char* type_name) noexcept;
+    static void on_end(const nunavut::support::TraceRecord& record) noexcept;
+    static void on_unaligned_copy(std::size_t length_bits) noexcept;
+};
+
+#define NUNAVUT_SUPPORT_TRACER ::CountingTracer
+
+#endif  // NUNAVUT_VERIFICATION_COUNTING_TRACER_HPP_INCLUDED
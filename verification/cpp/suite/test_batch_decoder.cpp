@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2022 UAVCAN Development Team.
+ * This software is distributed under the terms of the MIT License.
+ *
+ * Tests of the batch decoder
+ */
+
+#include "test_helpers.hpp"
+
+#if __cplusplus >= 201703L
+
+#include "nunavut/support/batch_decoder.hpp"
+#include "uavcan/node/Heartbeat_1_0.hpp"
+#include "uavcan/pnp/NodeIDAllocationData_2_0.hpp"
+
+#include <map>
+#include <mutex>
+#include <vector>
+
+namespace
+{
+
+using Registry = nunavut::support::PortRegistry<uavcan::node::Heartbeat_1_0, uavcan::pnp::NodeIDAllocationData_2_0>;
+
+static_assert(Registry::contains(uavcan::node::Heartbeat_1_0::FixedPortId), "");
+static_assert(not Registry::contains(1U), "");
+
+/// Serialized heartbeats and allocation requests from a few nodes, interleaved, with the sequence number of each
+/// on its port as the uptime of the heartbeats and the node-ID of the allocation requests.
+class Transfers
+{
+public:
+    explicit Transfers(const std::size_t count)
+    {
+        storage_.resize(count);
+        for (std::size_t i = 0U; i < count; ++i)
+        {
+            nunavut::support::bitspan out{storage_[i]};
+            std::size_t size = 0U;
+            std::uint16_t port_id = 0U;
+            if ((i % 3U) == 2U)
+            {
+                uavcan::pnp::NodeIDAllocationData_2_0 msg{};
+                msg.node_id.value = static_cast<std::uint16_t>(allocations_++);
+                msg.unique_id[0] = static_cast<std::uint8_t>(i);
+                size = msg.serialize(out).value();
+                port_id = uavcan::pnp::NodeIDAllocationData_2_0::FixedPortId;
+            }
+            else if ((i % 7U) == 6U)
+            {
+                port_id = 1U;  // Nothing is registered on this port.
+            }
+            else
+            {
+                uavcan::node::Heartbeat_1_0 msg{};
+                msg.uptime = heartbeats_++;
+                size = msg.serialize(out).value();
+                port_id = uavcan::node::Heartbeat_1_0::FixedPortId;
+            }
+            records.push_back({port_id, {storage_[i].data(), size}});
+        }
+    }
+
+    std::vector<nunavut::support::TransferRecord> records;
+
+private:
+    std::vector<std::array<std::uint8_t, 64U>> storage_;
+    std::uint32_t heartbeats_{0U};
+    std::uint32_t allocations_{0U};
+};
+
+/// Collects the sequence numbers seen on each port.
+struct Collector
+{
+    void operator()(const nunavut::support::TransferRecord& record, const uavcan::node::Heartbeat_1_0& msg)
+    {
+        const std::lock_guard<std::mutex> lock(mutex);
+        sequences[record.port_id].push_back(msg.uptime);
+    }
+
+    void operator()(const nunavut::support::TransferRecord& record, const uavcan::pnp::NodeIDAllocationData_2_0& msg)
+    {
+        const std::lock_guard<std::mutex> lock(mutex);
+        sequences[record.port_id].push_back(msg.node_id.value);
+    }
+
+    std::mutex mutex;
+    std::map<std::uint16_t, std::vector<std::uint32_t>> sequences;
+};
+
+/// A message that draws a copy of its payload from the arena, as the variable-length arrays of types generated with
+/// allocator support do.
+struct ArenaMessage
+{
+    static constexpr bool          HasFixedPortID = true;
+    static constexpr std::uint16_t FixedPortId    = 100U;
+    static constexpr std::size_t   PayloadBytes   = 64U;
+
+    nunavut::support::SerializeResult deserialize(nunavut::support::const_bitspan in_buffer)
+    {
+        return in_buffer.size() / 8U;
+    }
+
+    nunavut::support::SerializeResult deserialize(nunavut::support::const_bitspan   in_buffer,
+                                                  nunavut::support::MonotonicArena& arena)
+    {
+        bytes = static_cast<std::uint8_t*>(arena.allocate(PayloadBytes, alignof(std::uint8_t)));
+        if (bytes == nullptr)
+        {
+            return -nunavut::support::Error::DESERIALIZATION_OUT_OF_MEMORY;
+        }
+        in_buffer.getBits({bytes, PayloadBytes}, PayloadBytes * 8U);
+        return PayloadBytes;
+    }
+
+    std::uint8_t* bytes{nullptr};
+};
+
+void expect_in_order(const std::vector<std::uint32_t>& sequence)
+{
+    for (std::size_t i = 0U; i < sequence.size(); ++i)
+    {
+        ASSERT_EQ(i, sequence[i]);
+    }
+}
+
+} // namespace
+
+TEST(BatchDecoder, KeepsTheOrderOfEachPort)
+{
+    const Transfers transfers{1000U};
+    for (const std::size_t workers : {1U, 4U})
+    {
+        nunavut::support::BatchDecoder<Registry> decoder{workers};
+        ASSERT_EQ(workers, decoder.worker_count());
+        // Several batches through the same pool.
+        for (int batch = 0; batch < 3; ++batch)
+        {
+            Collector collector;
+            const auto stats = decoder.decode(transfers.records, collector);
+            ASSERT_EQ(0U, stats.failed);
+            ASSERT_EQ(1000U, stats.decoded + stats.unknown_port);
+            ASSERT_EQ(2U, collector.sequences.size());
+            const auto& heartbeats = collector.sequences[uavcan::node::Heartbeat_1_0::FixedPortId];
+            const auto& allocations = collector.sequences[uavcan::pnp::NodeIDAllocationData_2_0::FixedPortId];
+            ASSERT_EQ(stats.decoded, heartbeats.size() + allocations.size());
+            ASSERT_EQ(1000U / 3U, allocations.size());
+            expect_in_order(heartbeats);
+            expect_in_order(allocations);
+        }
+    }
+}
+
+TEST(BatchDecoder, EmptyBatch)
+{
+    nunavut::support::BatchDecoder<Registry> decoder{2U};
+    Collector collector;
+    const auto stats = decoder.decode(nullptr, 0U, collector);
+    ASSERT_EQ(0U, stats.decoded);
+    ASSERT_EQ(0U, stats.unknown_port);
+    ASSERT_TRUE(collector.sequences.empty());
+}
+
+TEST(BatchDecoder, ArenaOnlyHoldsOneMessage)
+{
+    // Each worker gets many more messages than its arena can hold at once.
+    constexpr std::size_t RecordCount = 100U;
+    std::vector<std::array<std::uint8_t, ArenaMessage::PayloadBytes>> payloads(RecordCount);
+    std::vector<nunavut::support::TransferRecord> records;
+    for (std::size_t i = 0U; i < RecordCount; ++i)
+    {
+        payloads[i].fill(static_cast<std::uint8_t>(i));
+        records.push_back({ArenaMessage::FixedPortId, {payloads[i].data(), payloads[i].size()}});
+    }
+
+    nunavut::support::BatchDecoder<nunavut::support::PortRegistry<ArenaMessage>, 2U * ArenaMessage::PayloadBytes>
+        decoder{2U};
+    std::vector<std::uint8_t> seen;
+    const auto stats = decoder.decode(records, [&seen](const nunavut::support::TransferRecord&, const ArenaMessage& msg) {
+        ASSERT_NE(nullptr, msg.bytes);
+        ASSERT_EQ(msg.bytes[0], msg.bytes[ArenaMessage::PayloadBytes - 1U]);
+        seen.push_back(msg.bytes[0]);  // One port, so the handler is never called concurrently.
+    });
+    ASSERT_EQ(RecordCount, stats.decoded);
+    ASSERT_EQ(0U, stats.failed);
+    ASSERT_EQ(RecordCount, seen.size());
+    for (std::size_t i = 0U; i < RecordCount; ++i)
+    {
+        ASSERT_EQ(i, seen[i]);
+    }
+}
+
+#endif // __cplusplus >= 201703L
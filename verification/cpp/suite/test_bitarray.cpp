@@ -8,6 +8,7 @@
 
 #include "test_helpers.hpp"
 #include "nunavut/support/serialization.hpp"
+#include "nunavut/support/segment_chain.hpp"
 
 
 TEST(BitSpan, Constructor) {
@@ -221,6 +222,38 @@ TEST(BitSpan, CopyBitsWithUnalignedOffset){
     ASSERT_EQ(0x54, dst[0]);
 }
 
+/// The word-at-a-time engine must produce the same output as the reference bytewise engine bit for bit, including
+/// the destination bits outside of the copied range.
+TEST(BitSpan, CopyBitsWordwiseMatchesBytewise){
+    using namespace nunavut::support;
+    const std::array<size_t, 16> lengths{ 1, 7, 8, 9, 63, 64, 65, 127, 128, 129, 191, 192, 193, 255, 256, 300 };
+    std::array<uint8_t, 64> src{};
+    for(size_t i = 0; i < src.size(); ++i)
+    {
+        src[i] = static_cast<uint8_t>((i * 37U) + 11U);
+    }
+    for(size_t src_off = 0; src_off < 16; ++src_off)
+    {
+        for(size_t dst_off = 0; dst_off < 16; ++dst_off)
+        {
+            for(const size_t length : lengths)
+            {
+                std::array<uint8_t, 64> expected{};
+                std::array<uint8_t, 64> wordwise{};
+                std::array<uint8_t, 64> selected{};
+                expected.fill(0xA5);
+                wordwise.fill(0xA5);
+                selected.fill(0xA5);
+                const_bitspan{src.data(), src.size(), src_off}.copyToBytewise(bitspan{expected, dst_off}, length);
+                const_bitspan{src.data(), src.size(), src_off}.copyToWordwise(bitspan{wordwise, dst_off}, length);
+                const_bitspan{src.data(), src.size(), src_off}.copyTo(bitspan{selected, dst_off}, length);
+                ASSERT_EQ(expected, wordwise) << "src_off=" << src_off << " dst_off=" << dst_off << " len=" << length;
+                ASSERT_EQ(expected, selected) << "src_off=" << src_off << " dst_off=" << dst_off << " len=" << length;
+            }
+        }
+    }
+}
+
 
 TEST(BitSpan, SaturateBufferFragmentBitLength)
 {
@@ -341,6 +374,255 @@ TEST(BitSpan, SetIxx_bufferOverflow)
     ASSERT_EQ(0xAA, buffer[2]);
 }
 
+// +--------------------------------------------------------------------------+
+// | Accessors specialized on the offset modulo and the bit length
+// +--------------------------------------------------------------------------+
+
+/// The specialized accessors must behave exactly like the generic ones, including when the runtime offset does not
+/// match the one given at compile time and when the field crosses the end of the buffer.
+template<uint8_t offset_mod, uint8_t len_bits>
+static void checkStaticAccessors()
+{
+    using namespace nunavut::support;
+    const uint64_t value = 0xF0E1D2C3B4A59687ULL ^ (static_cast<uint64_t>(len_bits) << 7U);
+    for (const size_t offset : {offset_mod + 8U, offset_mod + 9U})
+    {
+        std::array<uint8_t, 12> expected{};
+        std::array<uint8_t, 12> actual{};
+        expected.fill(0x5A);
+        actual.fill(0x5A);
+        ASSERT_TRUE(bitspan(expected, offset).setUxx(value, len_bits));
+        ASSERT_TRUE((bitspan(actual, offset).setUxx<offset_mod, len_bits>(value)));
+        ASSERT_EQ(expected, actual) << "offset=" << offset << " len=" << static_cast<int>(len_bits);
+        const const_bitspan in(actual.data(), actual.size(), offset);
+        ASSERT_EQ(in.getU64(len_bits), (in.getUxx<offset_mod, len_bits>()));
+        ASSERT_EQ(in.getI64(len_bits), (in.getIxx<offset_mod, len_bits>()));
+        // Implicit zero extension: only the first few bits of the field are inside of the buffer.
+        const const_bitspan truncated(actual.data(), (offset / 8U) + 1U, offset);
+        ASSERT_EQ(truncated.getU64(len_bits), (truncated.getUxx<offset_mod, len_bits>()));
+        ASSERT_EQ(truncated.getI64(len_bits), (truncated.getIxx<offset_mod, len_bits>()));
+    }
+    std::array<uint8_t, 2> small{};
+    const auto rc = bitspan(small, offset_mod + 8U).setUxx<offset_mod, len_bits>(value);
+    ASSERT_EQ((offset_mod + 8U + len_bits) <= 16U, static_cast<bool>(rc));
+}
+
+template<uint8_t offset_mod>
+static void checkStaticAccessorsAtOffset()
+{
+    checkStaticAccessors<offset_mod, 1U>();
+    checkStaticAccessors<offset_mod, 3U>();
+    checkStaticAccessors<offset_mod, 7U>();
+    checkStaticAccessors<offset_mod, 8U>();
+    checkStaticAccessors<offset_mod, 9U>();
+    checkStaticAccessors<offset_mod, 16U>();
+    checkStaticAccessors<offset_mod, 17U>();
+    checkStaticAccessors<offset_mod, 32U>();
+    checkStaticAccessors<offset_mod, 33U>();
+    checkStaticAccessors<offset_mod, 57U>();
+    checkStaticAccessors<offset_mod, 63U>();
+    checkStaticAccessors<offset_mod, 64U>();
+}
+
+TEST(BitSpan, StaticOffsetAccessors)
+{
+    checkStaticAccessorsAtOffset<0U>();
+    checkStaticAccessorsAtOffset<1U>();
+    checkStaticAccessorsAtOffset<2U>();
+    checkStaticAccessorsAtOffset<3U>();
+    checkStaticAccessorsAtOffset<4U>();
+    checkStaticAccessorsAtOffset<5U>();
+    checkStaticAccessorsAtOffset<6U>();
+    checkStaticAccessorsAtOffset<7U>();
+}
+
+TEST(BitSpan, StaticOffsetAccessorsFloat)
+{
+    using namespace nunavut::support;
+    std::array<uint8_t, 16> buffer{};
+    ASSERT_TRUE(bitspan(buffer, 3U).setF16<3U>(-2.5F));
+    ASSERT_TRUE(bitspan(buffer, 19U).setF32<3U>(1.25e-3F));
+    ASSERT_TRUE(bitspan(buffer, 51U).setF64<3U>(-6.0221e23));
+    ASSERT_TRUE(bitspan(buffer, 115U).setBit<3U>(true));
+    const const_bitspan in(buffer.data(), buffer.size());
+    ASSERT_FLOAT_EQ(-2.5F, in.at_offset(3U).getF16<3U>());
+    ASSERT_FLOAT_EQ(1.25e-3F, in.at_offset(19U).getF32<3U>());
+    ASSERT_DOUBLE_EQ(-6.0221e23, in.at_offset(51U).getF64<3U>());
+    ASSERT_TRUE(in.at_offset(115U).getBit<3U>());
+    ASSERT_FALSE(in.at_offset(116U).getBit<4U>());
+}
+
+// +--------------------------------------------------------------------------+
+// | Unchecked setters
+// +--------------------------------------------------------------------------+
+
+/// The unchecked setters must produce the same bits as the checked ones whenever the field fits into the buffer.
+TEST(BitSpan, UncheckedSettersMatchChecked)
+{
+    using namespace nunavut::support;
+    for (size_t offset = 0U; offset < 16U; ++offset)
+    {
+        std::array<uint8_t, 32> expected{};
+        std::array<uint8_t, 32> actual{};
+        expected.fill(0xA5);
+        actual.fill(0xA5);
+        bitspan exp(expected, offset);
+        bitspan act(actual, offset);
+
+        ASSERT_TRUE(exp.setBit(true));
+        act.setBitUnchecked(true);
+        exp.add_offset(1U);
+        act.add_offset(1U);
+        ASSERT_TRUE(exp.setUxx(0x1D2C3B4AULL, 29U));
+        act.setUxxUnchecked(0x1D2C3B4AULL, 29U);
+        exp.add_offset(29U);
+        act.add_offset(29U);
+        ASSERT_TRUE(exp.setIxx(-3, 5U));
+        act.setIxxUnchecked(-3, 5U);
+        exp.add_offset(5U);
+        act.add_offset(5U);
+        ASSERT_TRUE(exp.setZeros(11U));
+        act.setZerosUnchecked(11U);
+        exp.add_offset(11U);
+        act.add_offset(11U);
+        ASSERT_TRUE(exp.setF16(-2.5F));
+        act.setF16Unchecked(-2.5F);
+        exp.add_offset(16U);
+        act.add_offset(16U);
+        ASSERT_TRUE(exp.setF32(1.25e-3F));
+        act.setF32Unchecked(1.25e-3F);
+        exp.add_offset(32U);
+        act.add_offset(32U);
+        ASSERT_TRUE(exp.setF64(-6.0221e23));
+        act.setF64Unchecked(-6.0221e23);
+        exp.add_offset(64U);
+        act.add_offset(64U);
+        ASSERT_TRUE(exp.padAndMoveToAlignment(8U));
+        act.padAndMoveToAlignmentUnchecked(8U);
+        ASSERT_EQ(exp.offset(), act.offset());
+        ASSERT_EQ(expected, actual) << "offset=" << offset;
+    }
+}
+
+TEST(BitSpan, UncheckedStaticOffsetSetters)
+{
+    using namespace nunavut::support;
+    std::array<uint8_t, 24> expected{};
+    std::array<uint8_t, 24> actual{};
+    ASSERT_TRUE((bitspan(expected, 5U).setUxx<5U, 13U>(0x1234U)));
+    bitspan(actual, 5U).setUxxUnchecked<5U, 13U>(0x1234U);
+    ASSERT_TRUE((bitspan(expected, 18U).setIxx<2U, 7U>(-17)));
+    bitspan(actual, 18U).setIxxUnchecked<2U, 7U>(-17);
+    ASSERT_TRUE(bitspan(expected, 25U).setBit<1U>(true));
+    bitspan(actual, 25U).setBitUnchecked<1U>(true);
+    ASSERT_TRUE(bitspan(expected, 26U).setF16<2U>(0.5F));
+    bitspan(actual, 26U).setF16Unchecked<2U>(0.5F);
+    ASSERT_TRUE(bitspan(expected, 42U).setF32<2U>(-7.75F));
+    bitspan(actual, 42U).setF32Unchecked<2U>(-7.75F);
+    // Mismatching offset: falls back to the generic implementation.
+    ASSERT_TRUE(bitspan(expected, 75U).setF64<2U>(1.0e-300));
+    bitspan(actual, 75U).setF64Unchecked<2U>(1.0e-300);
+    ASSERT_EQ(expected, actual);
+}
+
+// +--------------------------------------------------------------------------+
+// | Bulk array accessors
+// +--------------------------------------------------------------------------+
+
+TEST(BitSpan, MakeSpan)
+{
+    std::array<uint16_t, 3> values{ 1, 2, 3 };
+    const auto view = nunavut::support::make_span(values);
+    ASSERT_EQ(3U, view.size());
+    ASSERT_EQ(values.data(), view.data());
+    view[1] = 20U;
+    ASSERT_EQ(20U, values[1]);
+
+    const std::array<uint16_t, 3>& const_values = values;
+    const auto const_view = nunavut::support::make_span(const_values);
+    static_assert(std::is_same<const uint16_t*, decltype(const_view.data())>::value, "Expected a view of const");
+    ASSERT_EQ(3U, const_view[2]);
+}
+
+TEST(BitSpan, ScatterGather)
+{
+    using namespace nunavut::support;
+    std::array<uint8_t, 10> src{};
+    for (size_t i = 0U; i < src.size(); ++i)
+    {
+        src[i] = static_cast<uint8_t>(i + 1U);
+    }
+    std::array<uint8_t, 3> first{};
+    std::array<uint8_t, 0> empty{};
+    std::array<uint8_t, 8> second{};
+    const bytespan segments[] = { make_span(first), make_span(empty), make_span(second) };
+    const bytespan_chain chain{ segments };
+    ASSERT_EQ(3U, chain.segment_count());
+    ASSERT_EQ(11U, chain.size());
+
+    ASSERT_EQ(10U, scatter({ src.data(), src.size() }, chain));
+    ASSERT_EQ(1U, first[0]);
+    ASSERT_EQ(3U, first[2]);
+    ASSERT_EQ(4U, second[0]);
+    ASSERT_EQ(10U, second[6]);
+    ASSERT_EQ(0U, second[7]);
+
+    const const_bytespan const_segments[] = { { first.data(), first.size() },
+                                              { empty.data(), empty.size() },
+                                              { second.data(), second.size() } };
+    const const_bytespan_chain const_chain{ const_segments };
+    std::array<uint8_t, 12> out{};
+    ASSERT_EQ(11U, gather(const_chain, { out.data(), out.size() }));
+    ASSERT_EQ(0, std::memcmp(src.data(), out.data(), src.size()));
+
+    std::array<uint8_t, 5> short_out{};
+    ASSERT_EQ(5U, gather(const_chain, { short_out.data(), short_out.size() }));
+    ASSERT_EQ(5U, short_out[4]);
+}
+
+TEST(BitSpan, SetGetBoolArray)
+{
+    using namespace nunavut::support;
+    std::array<bool, 150> values{};
+    for (size_t i = 0U; i < values.size(); ++i)
+    {
+        values[i] = ((i * 7U) % 3U) == 0U;
+    }
+    for (size_t offset = 0U; offset < 9U; ++offset)
+    {
+        std::array<uint8_t, 24> expected{};
+        std::array<uint8_t, 24> actual{};
+        expected.fill(0x3C);
+        actual.fill(0x3C);
+        bitspan exp(expected, offset);
+        for (const bool value : values)
+        {
+            ASSERT_TRUE(exp.setBit(value));
+            exp.add_offset(1U);
+        }
+        ASSERT_TRUE(bitspan(actual, offset).setBoolArray(values, values.size()));
+        ASSERT_EQ(expected, actual) << "offset=" << offset;
+
+        std::array<bool, 150> readback{};
+        const_bitspan(actual.data(), actual.size(), offset).getBoolArray(readback, readback.size());
+        ASSERT_EQ(values, readback);
+    }
+    // Implicit zero extension.
+    std::array<uint8_t, 1> short_buffer{ 0xFF };
+    std::array<bool, 12> readback{};
+    readback.fill(true);
+    const_bitspan(short_buffer.data(), short_buffer.size(), 4U).getBoolArray(readback, readback.size());
+    for (size_t i = 0U; i < readback.size(); ++i)
+    {
+        ASSERT_EQ(i < 4U, readback[i]) << "i=" << i;
+    }
+    // The buffer is too small.
+    std::array<uint8_t, 18> small{};
+    const auto rc = bitspan(small, 1U).setBoolArray(values, values.size());
+    ASSERT_FALSE(rc);
+    ASSERT_EQ(Error::SERIALIZATION_BUFFER_TOO_SMALL, rc.error());
+}
+
 // +--------------------------------------------------------------------------+
 // | nunavut[Get|Set]Bit
 // +--------------------------------------------------------------------------+
@@ -458,6 +740,48 @@ TEST(BitSpan, GetU64_tooSmall)
     ASSERT_EQ(0x0055555555555555U, nunavut::support::const_bitspan(data, sizeof(data), 9).getU64(64U));
 }
 
+/// Every offset and length near both ends of the buffer, covering the 64-bit window, the byte-aligned, and the
+/// implicit zero extension paths of the getters. getBits() is the reference.
+TEST(BitSpan, GetUxxMatchesGetBits)
+{
+    using namespace nunavut::support;
+    std::array<uint8_t, 24> data{};
+    for(size_t i = 0; i < data.size(); ++i)
+    {
+        data[i] = static_cast<uint8_t>((i * 73U) + 29U);
+    }
+    for(size_t size = 0; size <= data.size(); ++size)
+    {
+        for(size_t off = 0; off < (size * 8U) + 16U; ++off)
+        {
+            const const_bitspan in{data.data(), size, off};
+            for(uint8_t len = 1; len <= 64U; ++len)
+            {
+                std::array<uint8_t, 8> expected{};
+                const_bitspan{data.data(), size, off}.getBits(expected, len);
+                uint64_t reference = 0U;
+                for(size_t i = expected.size(); i > 0U; --i)
+                {
+                    reference = (reference << 8U) | expected[i - 1U];
+                }
+                ASSERT_EQ(reference, in.getU64(len)) << "size=" << size << " off=" << off << " len=" << int(len);
+                if (len <= 32U)
+                {
+                    ASSERT_EQ(static_cast<uint32_t>(reference), in.getU32(len));
+                }
+                if (len <= 16U)
+                {
+                    ASSERT_EQ(static_cast<uint16_t>(reference), in.getU16(len));
+                }
+                if (len <= 8U)
+                {
+                    ASSERT_EQ(static_cast<uint8_t>(reference), in.getU8(len));
+                }
+            }
+        }
+    }
+}
+
 // +--------------------------------------------------------------------------+
 // | nunavutGetI8
 // +--------------------------------------------------------------------------+
@@ -886,6 +1210,147 @@ TEST(BitSpan, Float16PackUnpack_NAN)
     ASSERT_TRUE(std::isnan(nunavut::support::float16Unpack(nunavut::support::float16Pack(NAN))));
 }
 
+// +--------------------------------------------------------------------------+
+// | nunavut::support::float16PackMany/UnpackMany
+// +--------------------------------------------------------------------------+
+
+static uint32_t helperFloatBits(const float value)
+{
+    uint32_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+///
+/// The batch kernels must agree with the scalar conversions bit for bit, NaN payloads and subnormals included.
+///
+TEST(BitSpan, Float16UnpackMany)
+{
+    std::vector<uint16_t> halves(0x10000U);
+    for (size_t i = 0; i < halves.size(); ++i)
+    {
+        halves[i] = static_cast<uint16_t>(i);
+    }
+    std::vector<float> unpacked(halves.size());
+    nunavut::support::float16UnpackMany(halves.data(), unpacked.data(), halves.size());
+    for (size_t i = 0; i < halves.size(); ++i)
+    {
+        ASSERT_EQ(helperFloatBits(nunavut::support::float16Unpack(halves[i])), helperFloatBits(unpacked[i]))
+            << "half=" << std::hex << i;
+    }
+}
+
+TEST(BitSpan, Float16PackMany)
+{
+    // Every float16 value, the halfway points between them, and their neighbours cover all rounding cases.
+    std::vector<float> values;
+    for (uint32_t i = 0; i < 0x10000U; ++i)
+    {
+        const uint32_t bits = helperFloatBits(nunavut::support::float16Unpack(static_cast<uint16_t>(i)));
+        for (const uint32_t delta : {0U, 1U, 0xFFFU, 0x1000U, 0x1001U, 0x1FFFU})
+        {
+            uint32_t shifted = bits + delta;
+            float value = 0;
+            std::memcpy(&value, &shifted, sizeof(value));
+            values.push_back(value);
+        }
+    }
+    values.push_back(65504.0f);
+    values.push_back(65520.0f);
+    values.push_back(-1e10f);
+    values.push_back(std::numeric_limits<float>::denorm_min());
+    values.push_back(std::numeric_limits<float>::max());
+    std::vector<uint16_t> packed(values.size());
+    nunavut::support::float16PackMany<false>(values.data(), packed.data(), values.size());
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        ASSERT_EQ(nunavut::support::float16Pack(values[i]), packed[i]) << "bits=" << std::hex << helperFloatBits(values[i]);
+    }
+
+    // Saturation clamps the finite values only.
+    const float edge[] = {1e10f, -1e10f, 65520.0f, std::numeric_limits<float>::infinity(), NAN, -0.0f};
+    uint16_t saturated[6];
+    nunavut::support::float16PackMany<true>(edge, saturated, 6U);
+    ASSERT_EQ(0x7BFFU, saturated[0]);
+    ASSERT_EQ(0xFBFFU, saturated[1]);
+    ASSERT_EQ(0x7BFFU, saturated[2]);
+    ASSERT_EQ(0x7C00U, saturated[3]);
+    ASSERT_EQ(0x7E00U, saturated[4] & 0x7E00U);
+    ASSERT_EQ(0x8000U, saturated[5]);
+
+    // The scalar saturation of the generated code gives the same results.
+    std::vector<uint16_t> packed_saturated(values.size());
+    nunavut::support::float16PackMany<true>(values.data(), packed_saturated.data(), values.size());
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        ASSERT_EQ(nunavut::support::float16Pack(nunavut::support::saturateFloat16(values[i])), packed_saturated[i])
+            << "bits=" << std::hex << helperFloatBits(values[i]);
+    }
+    for (size_t i = 0; i < 6U; ++i)
+    {
+        ASSERT_EQ(nunavut::support::float16Pack(nunavut::support::saturateFloat16(edge[i])), saturated[i]);
+    }
+    ASSERT_EQ(helperFloatBits(std::numeric_limits<float>::infinity()),
+              helperFloatBits(nunavut::support::saturateFloat16(std::numeric_limits<float>::infinity())));
+    ASSERT_EQ(helperFloatBits(-65504.0f), helperFloatBits(nunavut::support::saturateFloat16(-1e10f)));
+}
+
+TEST(BitSpan, Saturate)
+{
+    ASSERT_EQ(-512, nunavut::support::saturate<int16_t>(-0x6666, -512, 511));
+    ASSERT_EQ(511, nunavut::support::saturate<int16_t>(0x5555, -512, 511));
+    ASSERT_EQ(-7, nunavut::support::saturate<int16_t>(-7, -512, 511));
+    ASSERT_EQ(31U, nunavut::support::saturate<uint8_t>(200U, 0U, 31U));
+    ASSERT_EQ(0U, nunavut::support::saturate<uint8_t>(0U, 0U, 31U));
+}
+
+TEST(BitSpan, F16ArrayUnaligned)
+{
+    // More than one batch, written at an odd offset, must match the element by element encoding.
+    constexpr size_t Count = 75U;
+    float values[Count];
+    for (size_t i = 0; i < Count; ++i)
+    {
+        values[i] = (static_cast<float>(i) - 37.0f) * 1103.25f;
+    }
+    values[3] = NAN;
+
+    uint8_t expected[Count * 2U + 1U];
+    std::memset(expected, 0xA5, sizeof(expected));
+    uint8_t actual[Count * 2U + 1U];
+    std::memset(actual, 0xA5, sizeof(actual));
+    {
+        nunavut::support::bitspan sp{expected, sizeof(expected), 3U};
+        for (size_t i = 0; i < Count; ++i)
+        {
+            float value = values[i];
+            if (std::isfinite(value))
+            {
+                value = std::max(-65504.0f, std::min(65504.0f, value));
+            }
+            ASSERT_TRUE(sp.setF16(value));
+            sp.add_offset(16U);
+        }
+    }
+    nunavut::support::bitspan sp{actual, sizeof(actual), 3U};
+    ASSERT_FALSE(sp.setF16Array<true>(values, Count + 1U));
+    ASSERT_TRUE(sp.setF16Array<true>(values, Count));
+    ASSERT_EQ(0, std::memcmp(expected, actual, sizeof(actual)));
+
+    float read[Count];
+    nunavut::support::const_bitspan{actual, sizeof(actual), 3U}.getF16Array(read, Count);
+    for (size_t i = 0; i < Count; ++i)
+    {
+        const float scalar = nunavut::support::const_bitspan{actual, sizeof(actual), 3U + i * 16U}.getF16();
+        ASSERT_EQ(helperFloatBits(scalar), helperFloatBits(read[i])) << "index=" << i;
+    }
+
+    // The implicit zero extension rule applies past the end of the buffer.
+    nunavut::support::const_bitspan{actual, sizeof(actual), sizeof(actual) * 8U - 8U}.getF16Array(read, 2U);
+    ASSERT_EQ(helperFloatBits(nunavut::support::float16Unpack(actual[sizeof(actual) - 1U])), helperFloatBits(read[0]));
+    ASSERT_EQ(0U, helperFloatBits(read[1]));
+}
+
 // +--------------------------------------------------------------------------+
 // | testNunavutSetF16
 // +--------------------------------------------------------------------------+
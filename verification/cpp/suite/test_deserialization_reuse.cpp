@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2023 UAVCAN Development Team.
+ * This software is distributed under the terms of the MIT License.
+ *
+ * Tests of deserializing into the same object again and again, as generated with --enable-deserialization-reuse.
+ */
+
+#include "test_helpers.hpp"
+#include "regulated/basics/Union_0_1.hpp"
+
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+namespace
+{
+std::size_t allocations = 0U;
+}  // namespace
+
+// Every allocation of the test binary is counted so that the steady state can be shown to make none.
+void* operator new(std::size_t size)
+{
+    ++allocations;
+    void* const ptr = std::malloc((size == 0U) ? 1U : size);
+    if (ptr == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+namespace
+{
+
+using regulated::basics::Union_0_1;
+
+/// A Union_0_1 holding struct_, serialized.
+std::vector<uint8_t> makeStruct(const float f16, const uint8_t byte)
+{
+    Union_0_1 obj{};
+    auto& s = obj.set_struct_();
+    s.f16_le2.push_back(f16);
+    s.f16_le2.push_back(-f16);
+    s.bytes_lt3.push_back(byte);
+    s.bytes_lt3.push_back(static_cast<uint8_t>(byte + 1U));
+    s.u2_le4.push_back(3U);
+    s.delimited_fix_le2.push_back(regulated::basics::DelimitedFixedSize_0_1{});
+    s.aligned_bitpacked_le3.push_back(true);
+    std::vector<uint8_t> buffer(Union_0_1::SERIALIZATION_BUFFER_SIZE_BYTES);
+    const auto result = obj.serialize({buffer.data(), buffer.size()});
+    EXPECT_TRUE(result) << "Error was " << result.error();
+    buffer.resize(result ? result.value() : 0U);
+    return buffer;
+}
+
+/// A Union_0_1 holding delimited_fix_le2, serialized.
+std::vector<uint8_t> makeDelimited()
+{
+    Union_0_1 obj{};
+    (void) obj.set_delimited_fix_le2();
+    std::vector<uint8_t> buffer(Union_0_1::SERIALIZATION_BUFFER_SIZE_BYTES);
+    const auto result = obj.serialize({buffer.data(), buffer.size()});
+    EXPECT_TRUE(result) << "Error was " << result.error();
+    buffer.resize(result ? result.value() : 0U);
+    return buffer;
+}
+
+std::vector<uint8_t> reserialize(const Union_0_1& obj)
+{
+    std::vector<uint8_t> buffer(Union_0_1::SERIALIZATION_BUFFER_SIZE_BYTES);
+    const auto result = obj.serialize({buffer.data(), buffer.size()});
+    EXPECT_TRUE(result) << "Error was " << result.error();
+    buffer.resize(result ? result.value() : 0U);
+    return buffer;
+}
+
+}  // namespace
+
+TEST(DeserializationReuse, UnchangedAlternativeKeepsItsStorage)
+{
+    const auto first  = makeStruct(1.0F, 10U);
+    const auto second = makeStruct(2.5F, 20U);
+    const auto other  = makeDelimited();
+
+    Union_0_1 obj{};
+    ASSERT_TRUE(obj.deserialize({first.data(), first.size()}));
+    ASSERT_TRUE(obj.is_struct_());
+    const float* const   f16_storage   = obj.get_struct_().f16_le2.data();
+    const uint8_t* const bytes_storage = obj.get_struct_().bytes_lt3.data();
+
+    ASSERT_TRUE(obj.deserialize({second.data(), second.size()}));
+    ASSERT_TRUE(obj.is_struct_());
+    ASSERT_EQ(f16_storage, obj.get_struct_().f16_le2.data());
+    ASSERT_EQ(bytes_storage, obj.get_struct_().bytes_lt3.data());
+    ASSERT_FLOAT_EQ(-2.5F, obj.get_struct_().f16_le2[1]);
+    ASSERT_EQ(21U, obj.get_struct_().bytes_lt3[1]);
+    ASSERT_EQ(second, reserialize(obj));
+
+    // Switching alternatives still constructs the new one, and switching back gives the same result as a new object.
+    ASSERT_TRUE(obj.deserialize({other.data(), other.size()}));
+    ASSERT_TRUE(obj.is_delimited_fix_le2());
+    ASSERT_EQ(other, reserialize(obj));
+    ASSERT_TRUE(obj.deserialize({first.data(), first.size()}));
+    ASSERT_TRUE(obj.is_struct_());
+    ASSERT_EQ(first, reserialize(obj));
+}
+
+TEST(DeserializationReuse, SteadyStateDoesNotAllocate)
+{
+    const auto first  = makeStruct(1.0F, 10U);
+    const auto second = makeStruct(-3.0F, 30U);
+
+    Union_0_1 obj{};
+    ASSERT_TRUE(obj.deserialize({first.data(), first.size()}));
+    const std::size_t allocations_before = allocations;
+    bool ok = true;
+    for (int i = 0; i < 100; ++i)
+    {
+        const auto& input = ((i % 2) == 0) ? second : first;
+        ok = ok && static_cast<bool>(obj.deserialize({input.data(), input.size()}));
+    }
+    const std::size_t allocations_after = allocations;
+    ASSERT_TRUE(ok);
+    ASSERT_EQ(allocations_before, allocations_after);
+    ASSERT_EQ(first, reserialize(obj));
+}
@@ -14,6 +14,7 @@ testing::Message& operator<<(testing::Message& s, const nunavut::support::Error&
     switch(e){
     case Error::SERIALIZATION_INVALID_ARGUMENT: s << "SERIALIZATION_INVALID_ARGUMENT"; break;
     case Error::SERIALIZATION_BUFFER_TOO_SMALL: s << "SERIALIZATION_BUFFER_TOO_SMALL"; break;
+    case Error::DESERIALIZATION_OUT_OF_MEMORY: s << "DESERIALIZATION_OUT_OF_MEMORY"; break;
     case Error::REPRESENTATION_BAD_ARRAY_LENGTH: s << "REPRESENTATION_BAD_ARRAY_LENGTH"; break;
     case Error::REPRESENTATION_BAD_UNION_TAG: s << "REPRESENTATION_BAD_UNION_TAG"; break;
     case Error::REPRESENTATION_BAD_DELIMITER_HEADER: s << "REPRESENTATION_BAD_DELIMITER_HEADER"; break;
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2023 UAVCAN Development Team.
+ * This software is distributed under the terms of the MIT License.
+ *
+ * Tests of the types generated with --enable-out-of-line-serialization. The serialization functions of the regulated
+ * test types are defined in the generated source files linked into this test; the uavcan types keep theirs inline
+ * (--inline-serialization-types uavcan.*).
+ */
+
+#include "test_helpers.hpp"
+#include "regulated/basics/DelimitedVariableSize_0_1.hpp"
+#include "regulated/basics/Service_0_1.hpp"
+#include "regulated/basics/Struct__0_1.hpp"
+#include "uavcan/node/Heartbeat_1_0.hpp"
+
+#include <limits>
+#include <vector>
+
+namespace
+{
+
+template <typename T>
+std::vector<uint8_t> serialize(const T& obj)
+{
+    std::vector<uint8_t> buffer(T::SERIALIZATION_BUFFER_SIZE_BYTES);
+    const auto result = obj.serialize({buffer.data(), buffer.size()});
+    EXPECT_TRUE(result) << "Error was " << result.error();
+    buffer.resize(result ? result.value() : 0U);
+    return buffer;
+}
+
+}  // namespace
+
+TEST(OutOfLineSerialization, Union)
+{
+    regulated::basics::DelimitedVariableSize_0_1 obj{};
+    obj.set_f16(+1e9F);  // truncated to infinity
+    const std::vector<uint8_t> expected{0x00, 0x00, 0x7C};
+    ASSERT_EQ(expected, serialize(obj));
+
+    regulated::basics::DelimitedVariableSize_0_1 back{};
+    back.set_f64(1.0);
+    const auto result = back.deserialize({expected.data(), expected.size()});
+    ASSERT_TRUE(result) << "Error was " << result.error();
+    ASSERT_EQ(expected.size(), result.value());
+    ASSERT_TRUE(back.is_f16());
+    ASSERT_FLOAT_EQ(std::numeric_limits<float>::infinity(), *back.get_f16_if());
+}
+
+TEST(OutOfLineSerialization, NestedTypes)
+{
+    // The nested DelimitedVariableSize is serialized out of line as well, the nested uavcan.primitive.Empty inline.
+    regulated::basics::Struct__0_1 obj{};
+    obj.boolean = true;
+    obj.i10_4[0] = 511;
+    obj.bytes_lt3.push_back(111);
+    obj.u16_2[1] = 0x5678;
+    obj.delimited_var_2[0].set_f32(2.5F);
+    obj.delimited_var_2[1].set_f64(-1e40);
+    const auto buffer = serialize(obj);
+    ASSERT_EQ(obj.serialized_size_bytes(), buffer.size());
+
+    regulated::basics::Struct__0_1 back{};
+    const auto result = back.deserialize({buffer.data(), buffer.size()});
+    ASSERT_TRUE(result) << "Error was " << result.error();
+    ASSERT_EQ(buffer.size(), result.value());
+    ASSERT_TRUE(back.boolean);
+    ASSERT_EQ(511, back.i10_4[0]);
+    ASSERT_EQ(1U, back.bytes_lt3.size());
+    ASSERT_EQ(0x5678U, back.u16_2[1]);
+    ASSERT_TRUE(back.delimited_var_2[0].is_f32());
+    ASSERT_TRUE(back.delimited_var_2[1].is_f64());
+    ASSERT_EQ(buffer, serialize(back));
+
+    // The buffer size checks are in the out-of-line definitions too.
+    std::vector<uint8_t> short_buffer(buffer.size() - 1U);
+    const auto too_small = obj.serialize({short_buffer.data(), short_buffer.size()});
+    ASSERT_FALSE(too_small);
+    ASSERT_EQ(nunavut::support::Error::SERIALIZATION_BUFFER_TOO_SMALL, too_small.error());
+}
+
+TEST(OutOfLineSerialization, ServiceTypes)
+{
+    // Both halves of a service are defined in the one source file generated for it.
+    uint8_t buffer[8]{};
+    const regulated::basics::Service::Request_0_1 request{};
+    const auto serialized = request.serialize(buffer);
+    ASSERT_TRUE(serialized) << "Error was " << serialized.error();
+    ASSERT_EQ(0U, serialized.value());
+
+    regulated::basics::Service::Response_0_1 response{};
+    const auto deserialized = response.deserialize({&buffer[0], 0U});
+    ASSERT_TRUE(deserialized) << "Error was " << deserialized.error();
+    ASSERT_EQ(0U, deserialized.value());
+}
+
+TEST(OutOfLineSerialization, InlineTypes)
+{
+    uavcan::node::Heartbeat_1_0 obj{};
+    obj.uptime = 0x12345678UL;
+    obj.vendor_specific_status_code = 0xA5U;
+    const std::vector<uint8_t> expected{0x78, 0x56, 0x34, 0x12, 0x00, 0x00, 0xA5};
+    ASSERT_EQ(expected, serialize(obj));
+
+    uavcan::node::Heartbeat_1_0 back{};
+    const auto result = back.deserialize({expected.data(), expected.size()});
+    ASSERT_TRUE(result) << "Error was " << result.error();
+    ASSERT_EQ(0x12345678UL, back.uptime);
+    ASSERT_EQ(0xA5U, back.vendor_specific_status_code);
+}
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2022 UAVCAN Development Team.
+ * This software is distributed under the terms of the MIT License.
+ *
+ * Tests of the port dispatch tables in the namespace headers
+ */
+
+#include "test_helpers.hpp"
+#include "regulated/_namespace_.hpp"
+#include "uavcan/_namespace_.hpp"
+
+#include <array>
+
+namespace
+{
+
+using Basics = regulated::basics::PortDispatch<>;
+using Uavcan = uavcan::PortDispatch<>;
+
+static_assert(Basics::Messages.find(regulated::basics::Struct__0_1::FixedPortId) != nullptr, "");
+static_assert(Basics::Messages.find(regulated::basics::Struct__0_1::FixedPortId)->extent_bytes ==
+                  regulated::basics::Struct__0_1::EXTENT_BYTES,
+              "");
+static_assert(Basics::Messages.find(regulated::basics::Service::Request_0_1::FixedPortId) == nullptr,
+              "Service-IDs are not subject-IDs.");
+static_assert(Basics::Requests.find(regulated::basics::Service::Request_0_1::FixedPortId)->extent_bytes ==
+                  regulated::basics::Service::Request_0_1::EXTENT_BYTES,
+              "");
+static_assert(Basics::Responses.find(regulated::basics::Service::Response_0_1::FixedPortId)->extent_bytes ==
+                  regulated::basics::Service::Response_0_1::EXTENT_BYTES,
+              "");
+static_assert(Uavcan::Messages.find(uavcan::node::Heartbeat_1_0::FixedPortId) ==
+                  uavcan::node::PortDispatch<>::Messages.find(uavcan::node::Heartbeat_1_0::FixedPortId),
+              "A namespace lists the types of the namespaces nested in it.");
+
+} // namespace
+
+TEST(PortDispatch, TablesAreSorted)
+{
+    for (const nunavut::support::PortDispatchTable& table :
+         {Uavcan::Messages, Uavcan::Requests, Uavcan::Responses, regulated::PortDispatch<>::Messages})
+    {
+        ASSERT_LT(0U, table.size);
+        for (const auto* entry = table.begin() + 1; entry != table.end(); ++entry)
+        {
+            ASSERT_LT((entry - 1)->port_id, entry->port_id);
+        }
+        for (const auto& entry : table)
+        {
+            ASSERT_EQ(&entry, table.find(entry.port_id));
+        }
+    }
+}
+
+TEST(PortDispatch, RoundTripThroughThunks)
+{
+    const auto* const entry = nunavut::support::find_port(uavcan::node::Heartbeat_1_0::FixedPortId,
+                                                          regulated::PortDispatch<>::Messages,
+                                                          Uavcan::Messages);
+    ASSERT_NE(nullptr, entry);
+    ASSERT_STREQ("uavcan.node.Heartbeat.1.0", entry->full_name);
+
+    uavcan::node::Heartbeat_1_0 sent{};
+    sent.uptime = 0x12345678UL;
+    std::array<std::uint8_t, uavcan::node::Heartbeat_1_0::EXTENT_BYTES> buffer{};
+    const auto serialized = entry->serialize(&sent, {buffer});
+    ASSERT_TRUE(serialized) << "Error was " << serialized.error();
+
+    uavcan::node::Heartbeat_1_0 received{};
+    const auto deserialized = entry->deserialize(&received, {buffer.data(), serialized.value()});
+    ASSERT_TRUE(deserialized) << "Error was " << deserialized.error();
+    ASSERT_EQ(sent.uptime, received.uptime);
+}
+
+TEST(PortDispatch, UnknownPort)
+{
+    ASSERT_EQ(nullptr, nunavut::support::find_port(0U, regulated::PortDispatch<>::Messages, Uavcan::Messages));
+    ASSERT_EQ(nullptr, nunavut::support::find_port(0U));
+}
@@ -11,6 +11,13 @@
 #include "regulated/basics/Struct__0_1.hpp"
 #include "regulated/basics/Service_0_1.hpp"
 #include "regulated/basics/Primitive_0_1.hpp"
+#include "regulated/basics/Union_0_1.hpp"
+#include "regulated/basics/PrimitiveArrayVariable_0_1.hpp"
+#include "regulated/basics/PrimitiveArrayFixed_0_1.hpp"
+#include "uavcan/node/Heartbeat_1_0.hpp"
+#include "nunavut/support/buffer_pool.hpp"
+#include "nunavut/support/relocation.hpp"
+#include "nunavut/support/segment_chain.hpp"
 
 
 static_assert(
@@ -400,6 +407,477 @@ TEST(Serialization, StructReference)
 }
 
 
+TEST(Serialization, StructFieldMask)
+{
+    regulated::basics::Struct__0_1 obj{};
+    obj.boolean = true;
+    obj.f16_le2.push_back(-1.0F);
+    obj.bytes_lt3.push_back(111);
+    obj.u2_le4.push_back(0x02);
+    obj.delimited_fix_le2.push_back();
+    obj.u16_2[0] = 0x1234;
+    obj.u16_2[1] = 0x5678;
+    obj.delimited_var_2[1].set_f64(-1e40);
+    obj.aligned_bitpacked_le3.push_back(true);
+
+    uint8_t buf[regulated::basics::Struct__0_1::SERIALIZATION_BUFFER_SIZE_BYTES]{};
+    const auto result = obj.serialize(buf);
+    ASSERT_TRUE(result) << "Error was " << result.error();
+
+    // Only the selected fields are decoded; the ones behind or between them are skipped over.
+    regulated::basics::Struct__0_1::FieldMask mask{};
+    mask.u16_2                 = true;
+    mask.aligned_bitpacked_le3 = true;
+    regulated::basics::Struct__0_1 partial{};
+    partial.bytes_lt3.push_back(42);
+    const auto partial_result = partial.deserialize({&buf[0], result.value()}, mask);
+    ASSERT_TRUE(partial_result) << "Error was " << partial_result.error();
+    ASSERT_EQ(result.value(), partial_result.value());
+    ASSERT_EQ(0x1234, partial.u16_2[0]);
+    ASSERT_EQ(0x5678, partial.u16_2[1]);
+    ASSERT_EQ(1U, partial.aligned_bitpacked_le3.size());
+    ASSERT_TRUE(partial.aligned_bitpacked_le3[0]);
+    ASSERT_FALSE(partial.boolean);
+    ASSERT_EQ(0U, partial.f16_le2.size());
+    ASSERT_EQ(1U, partial.bytes_lt3.size());
+    ASSERT_EQ(42, partial.bytes_lt3[0]);
+    ASSERT_EQ(0U, partial.delimited_fix_le2.size());
+    ASSERT_EQ(0U, partial.delimited_var_2[1].union_value.index());
+
+    // An empty mask decodes nothing but still consumes the whole object.
+    regulated::basics::Struct__0_1 none{};
+    const auto none_result = none.deserialize({&buf[0], result.value()}, regulated::basics::Struct__0_1::FieldMask{});
+    ASSERT_TRUE(none_result) << "Error was " << none_result.error();
+    ASSERT_EQ(result.value(), none_result.value());
+    ASSERT_EQ(0U, none.aligned_bitpacked_le3.size());
+}
+
+TEST(Serialization, StructFieldMaskBadInput)
+{
+    using nunavut::support::Error;
+    regulated::basics::Struct__0_1 obj{};
+    obj.f16_le2.push_back(-1.0F);
+    obj.u16_2[0] = 0x1234;
+    obj.delimited_var_2[1].set_f64(-1e40);
+    obj.aligned_bitpacked_le3.push_back(true);
+    uint8_t buf[regulated::basics::Struct__0_1::SERIALIZATION_BUFFER_SIZE_BYTES]{};
+    const auto result = obj.serialize(buf);
+    ASSERT_TRUE(result) << "Error was " << result.error();
+
+    // The fields that are skipped over are checked like the decoded ones.
+    regulated::basics::Struct__0_1::FieldMask mask{};
+    mask.u16_2 = true;
+    regulated::basics::Struct__0_1 out{};
+
+    // The delimiter header of delimited_var_2[1] runs past the end of the buffer.
+    auto masked_result = out.deserialize({&buf[0], result.value() - 3U}, mask);
+    ASSERT_FALSE(masked_result);
+    ASSERT_EQ(Error::REPRESENTATION_BAD_DELIMITER_HEADER, masked_result.error());
+    auto full_result = out.deserialize({&buf[0], result.value() - 3U});
+    ASSERT_FALSE(full_result);
+    ASSERT_EQ(Error::REPRESENTATION_BAD_DELIMITER_HEADER, full_result.error());
+
+    // The length of f16_le2, at bit 42, exceeds its capacity of 2.
+    buf[5] = static_cast<uint8_t>(buf[5] | 0xFCU);
+    masked_result = out.deserialize({&buf[0], result.value()}, mask);
+    ASSERT_FALSE(masked_result);
+    ASSERT_EQ(Error::REPRESENTATION_BAD_ARRAY_LENGTH, masked_result.error());
+    full_result = out.deserialize({&buf[0], result.value()});
+    ASSERT_FALSE(full_result);
+    ASSERT_EQ(Error::REPRESENTATION_BAD_ARRAY_LENGTH, full_result.error());
+
+    // A nested object that is skipped over is walked by its skip_bits(), which checks it the same way.
+    regulated::basics::Union_0_1 u{};
+    u.set_struct_(obj);
+    uint8_t union_buf[regulated::basics::Union_0_1::SERIALIZATION_BUFFER_SIZE_BYTES]{};
+    const auto union_result = u.serialize(union_buf);
+    ASSERT_TRUE(union_result) << "Error was " << union_result.error();
+    union_buf[6] = static_cast<uint8_t>(union_buf[6] | 0xFCU);  // f16_le2 again, one byte further in.
+    regulated::basics::Union_0_1 union_out{};
+    const auto union_masked_result =
+        union_out.deserialize({&union_buf[0], union_result.value()}, regulated::basics::Union_0_1::FieldMask{});
+    ASSERT_FALSE(union_masked_result);
+    ASSERT_EQ(Error::REPRESENTATION_BAD_ARRAY_LENGTH, union_masked_result.error());
+    const auto skipped = regulated::basics::Struct__0_1::skip_bits({&buf[0], result.value()});
+    ASSERT_FALSE(skipped);
+    ASSERT_EQ(Error::REPRESENTATION_BAD_ARRAY_LENGTH, skipped.error());
+}
+
+TEST(Serialization, StructSegmentChain)
+{
+    using namespace nunavut::support;
+    regulated::basics::Struct__0_1 obj{};
+    obj.boolean = true;
+    obj.f16_le2.push_back(-1.0F);
+    obj.bytes_lt3.push_back(111);
+    obj.bytes_lt3.push_back(222);
+    obj.u16_2[0] = 0x1234;
+    obj.u16_2[1] = 0x5678;
+    obj.delimited_var_2[1].set_f64(-1e40);
+    obj.aligned_bitpacked_le3.push_back(true);
+
+    uint8_t contiguous[regulated::basics::Struct__0_1::SERIALIZATION_BUFFER_SIZE_BYTES]{};
+    const auto result = obj.serialize(contiguous);
+    ASSERT_TRUE(result) << "Error was " << result.error();
+
+    // Frame-sized segments force the staged path.
+    constexpr size_t SegmentSize = 7U;
+    constexpr size_t SegmentCount = (regulated::basics::Struct__0_1::SERIALIZATION_BUFFER_SIZE_BYTES / SegmentSize) + 1U;
+    uint8_t frames[SegmentCount][SegmentSize]{};
+    std::vector<bytespan> segments;
+    std::vector<const_bytespan> const_segments;
+    for (size_t i = 0U; i < SegmentCount; ++i)
+    {
+        segments.emplace_back(&frames[i][0], SegmentSize);
+        const_segments.emplace_back(&frames[i][0], SegmentSize);
+    }
+    const auto chain_result = serialize_to_chain(obj, bytespan_chain{segments.data(), segments.size()});
+    ASSERT_TRUE(chain_result) << "Error was " << chain_result.error();
+    ASSERT_EQ(result.value(), chain_result.value());
+    for (size_t i = 0U; i < result.value(); ++i)
+    {
+        ASSERT_EQ(contiguous[i], frames[i / SegmentSize][i % SegmentSize]) << "Mismatch at byte " << i;
+    }
+
+    // A chain too short for the serialized object is rejected.
+    const auto short_result = serialize_to_chain(obj, bytespan_chain{segments.data(), 1U});
+    ASSERT_FALSE(short_result);
+    ASSERT_EQ(Error::SERIALIZATION_BUFFER_TOO_SMALL, short_result.error());
+
+    regulated::basics::Struct__0_1 read{};
+    const auto read_result = deserialize_from_chain(read, const_bytespan_chain{const_segments.data(), const_segments.size()});
+    ASSERT_TRUE(read_result) << "Error was " << read_result.error();
+    ASSERT_TRUE(read.boolean);
+    ASSERT_EQ(2U, read.bytes_lt3.size());
+    ASSERT_EQ(222, read.bytes_lt3[1]);
+    ASSERT_EQ(0x5678, read.u16_2[1]);
+    ASSERT_TRUE(read.delimited_var_2[1].is_f64());
+    ASSERT_EQ(1U, read.aligned_bitpacked_le3.size());
+
+    // A first segment that holds the whole object is written in place.
+    uint8_t single[regulated::basics::Struct__0_1::SERIALIZATION_BUFFER_SIZE_BYTES]{};
+    const bytespan single_segment[] = {bytespan{&single[0], sizeof(single)}};
+    const auto single_result = serialize_to_chain(obj, bytespan_chain{single_segment}, bytespan{nullptr, 0U});
+    ASSERT_TRUE(single_result) << "Error was " << single_result.error();
+    ASSERT_EQ(0, std::memcmp(&contiguous[0], &single[0], result.value()));
+}
+
+TEST(Serialization, StructBatch)
+{
+    using namespace nunavut::support;
+    using T = regulated::basics::PrimitiveArrayVariable_0_1;
+    std::vector<T> objects(3);
+    for (size_t i = 0U; i < objects.size(); ++i)
+    {
+        for (size_t k = 0U; k <= i; ++k)
+        {
+            objects[i].a_f16.push_back(static_cast<float>(k) * 0.5F - 1.0F);
+        }
+        objects[i].n_u8.push_back(static_cast<uint8_t>(i));
+    }
+
+    std::vector<uint8_t> buffer(T::SERIALIZATION_BUFFER_SIZE_BYTES * objects.size());
+    const auto result = serialize_many(span<const T>{objects.data(), objects.size()}, bytespan{buffer.data(), buffer.size()});
+    ASSERT_TRUE(result) << "Error was " << result.error();
+
+    // The batch is the concatenation of the individual representations.
+    std::vector<uint8_t> single(T::SERIALIZATION_BUFFER_SIZE_BYTES);
+    size_t offset = 0U;
+    for (const T& obj : objects)
+    {
+        const auto single_result = obj.serialize(bitspan{single.data(), single.size()});
+        ASSERT_TRUE(single_result) << "Error was " << single_result.error();
+        ASSERT_EQ(0, std::memcmp(single.data(), buffer.data() + offset, single_result.value()));
+        offset += single_result.value();
+    }
+    ASSERT_EQ(offset, result.value());
+
+    std::vector<T> read(objects.size());
+    const auto read_result = deserialize_many(span<T>{read.data(), read.size()}, const_bytespan{buffer.data(), result.value()});
+    ASSERT_TRUE(read_result) << "Error was " << read_result.error();
+    ASSERT_EQ(result.value(), read_result.value());
+    for (size_t i = 0U; i < read.size(); ++i)
+    {
+        ASSERT_EQ(i + 1U, read[i].a_f16.size());
+        ASSERT_FLOAT_EQ(static_cast<float>(i) * 0.5F - 1.0F, read[i].a_f16[i]);
+        ASSERT_EQ(i, read[i].n_u8[0]);
+    }
+
+    // Each object needs room for its own representation, like a single serialize() call.
+    const auto short_result = serialize_many(span<const T>{objects.data(), objects.size()}, bytespan{buffer.data(), result.value() - 1U});
+    ASSERT_FALSE(short_result);
+    ASSERT_EQ(Error::SERIALIZATION_BUFFER_TOO_SMALL, short_result.error());
+}
+
+TEST(Serialization, StructSerializedSize)
+{
+    using namespace nunavut::support;
+    regulated::basics::Struct__0_1 obj{};
+    uint8_t buffer[regulated::basics::Struct__0_1::SERIALIZATION_BUFFER_SIZE_BYTES]{};
+    const auto empty_result = obj.serialize(buffer);
+    ASSERT_TRUE(empty_result) << "Error was " << empty_result.error();
+    ASSERT_EQ(empty_result.value(), obj.serialized_size_bytes());
+
+    obj.boolean = true;
+    obj.f16_le2.push_back(-1.0F);
+    obj.bytes_lt3.push_back(111);
+    obj.u2_le4.push_back(3);
+    obj.u2_le4.push_back(1);
+    obj.u2_le4.push_back(2);
+    obj.delimited_fix_le2.push_back(regulated::basics::DelimitedFixedSize_0_1{});
+    obj.delimited_var_2[0].set_f16(2.0F);
+    obj.delimited_var_2[1].set_f64(-1e40);
+    obj.aligned_bitpacked_le3.push_back(true);
+    const auto result = obj.serialize(buffer);
+    ASSERT_TRUE(result) << "Error was " << result.error();
+    const std::size_t size_bytes = obj.serialized_size_bytes();
+    ASSERT_EQ(result.value(), size_bytes);
+    ASSERT_LT(size_bytes, sizeof(buffer));
+
+    // A buffer of exactly that size is enough, down to the nested objects; one byte less is not.
+    std::vector<uint8_t> exact(size_bytes);
+    const auto exact_result = obj.serialize({exact.data(), exact.size()});
+    ASSERT_TRUE(exact_result) << "Error was " << exact_result.error();
+    ASSERT_EQ(0, std::memcmp(buffer, exact.data(), size_bytes));
+    const auto short_result = obj.serialize({exact.data(), exact.size() - 1U});
+    ASSERT_FALSE(short_result);
+    ASSERT_EQ(Error::SERIALIZATION_BUFFER_TOO_SMALL, short_result.error());
+
+    // Unions are measured by the active variant.
+    regulated::basics::Union_0_1 u{};
+    u.set_delimited_var_le2().push_back(regulated::basics::DelimitedVariableSize_0_1{});
+    uint8_t union_buffer[regulated::basics::Union_0_1::SERIALIZATION_BUFFER_SIZE_BYTES]{};
+    const auto union_result = u.serialize(union_buffer);
+    ASSERT_TRUE(union_result) << "Error was " << union_result.error();
+    ASSERT_EQ(union_result.value(), u.serialized_size_bytes());
+    std::vector<uint8_t> union_exact(u.serialized_size_bytes());
+    ASSERT_LT(union_exact.size(), sizeof(union_buffer));
+    const auto union_exact_result = u.serialize({union_exact.data(), union_exact.size()});
+    ASSERT_TRUE(union_exact_result) << "Error was " << union_exact_result.error();
+    ASSERT_EQ(0, std::memcmp(union_buffer, union_exact.data(), union_exact.size()));
+    const auto union_short_result = u.serialize({union_exact.data(), union_exact.size() - 1U});
+    ASSERT_FALSE(union_short_result);
+    ASSERT_EQ(Error::SERIALIZATION_BUFFER_TOO_SMALL, union_short_result.error());
+
+    // The size of a fixed-length type is a constant, and its buffer cannot be any smaller.
+    static_assert(regulated::basics::DelimitedFixedSize_0_1::SERIALIZATION_BUFFER_SIZE_BYTES ==
+                  regulated::basics::DelimitedFixedSize_0_1{}.serialized_size_bytes(), "");
+    const regulated::basics::DelimitedFixedSize_0_1 fixed{};
+    uint8_t fixed_buffer[regulated::basics::DelimitedFixedSize_0_1::SERIALIZATION_BUFFER_SIZE_BYTES]{};
+    const auto fixed_result = fixed.serialize(fixed_buffer);
+    ASSERT_TRUE(fixed_result) << "Error was " << fixed_result.error();
+    ASSERT_EQ(sizeof(fixed_buffer), fixed_result.value());
+    const auto fixed_short_result = fixed.serialize({&fixed_buffer[0], sizeof(fixed_buffer) - 1U});
+    ASSERT_FALSE(fixed_short_result);
+    ASSERT_EQ(Error::SERIALIZATION_BUFFER_TOO_SMALL, fixed_short_result.error());
+}
+
+TEST(Serialization, NestedInPlace)
+{
+    using namespace nunavut::support;
+    uavcan::node::Heartbeat_1_0 msg{};
+    msg.uptime = 0x12345678U;
+    msg.health.value = 2U;
+    msg.mode.value = 3U;
+    msg.vendor_specific_status_code = 0xA5U;
+    std::array<uint8_t, uavcan::node::Heartbeat_1_0::SERIALIZATION_BUFFER_SIZE_BYTES> expected{};
+    const auto result = msg.serialize(expected);
+    ASSERT_TRUE(result) << "Error was " << result.error();
+
+    // Types nesting this one write it at their own offset and continue after it.
+    std::array<uint8_t, expected.size() + 4U> buffer{};
+    buffer.fill(0xEEU);
+    bitspan out{buffer, 3U * 8U};
+    msg.serialize_into_unchecked(out);
+    ASSERT_EQ((3U + expected.size()) * 8U, out.offset());
+    ASSERT_EQ(0, std::memcmp(expected.data(), &buffer[3], expected.size()));
+    ASSERT_EQ(0xEEU, buffer[2]);
+    ASSERT_EQ(0xEEU, buffer[3U + expected.size()]);
+}
+
+#if NUNAVUT_SUPPORT_CONSTEXPR_SERIALIZATION
+
+constexpr uavcan::node::Heartbeat_1_0 make_heartbeat()
+{
+    uavcan::node::Heartbeat_1_0 msg{};
+    msg.uptime = 0x12345678U;
+    msg.health.value = 2U;
+    msg.mode.value = 3U;
+    msg.vendor_specific_status_code = 0xA5U;
+    return msg;
+}
+
+constexpr regulated::basics::PrimitiveArrayFixed_0_1 make_primitive_array_fixed()
+{
+    regulated::basics::PrimitiveArrayFixed_0_1 obj{};
+    obj.a_u64[0] = 0x0123456789ABCDEFULL;
+    obj.n_u7[1] = 0x55U;
+    obj.a_i32[1] = -2;
+    obj.n_i16[0] = -3;
+    obj.a_f64[0] = -1.5;
+    obj.n_f32[1] = 0.25F;
+    obj.a_f16[0] = 1e9F; // Saturated to the float16 maximum.
+    obj.n_f16[1] = -2.0F;
+    obj.a_bool[1] = true;
+    obj.n_bool[0] = true;
+    return obj;
+}
+
+template <typename T>
+void expect_same_as_runtime(const T& obj, const std::array<std::uint8_t, T::SERIALIZATION_BUFFER_SIZE_BYTES>& frame)
+{
+    std::array<std::uint8_t, T::SERIALIZATION_BUFFER_SIZE_BYTES> runtime{};
+    const auto result = obj.serialize({runtime.data(), runtime.size()});
+    ASSERT_TRUE(result) << "Error was " << result.error();
+    ASSERT_EQ(runtime, frame);
+}
+
+TEST(Serialization, ConstantFrames)
+{
+    static constexpr auto heartbeat = nunavut::support::to_bytes(make_heartbeat());
+    static_assert(heartbeat[0] == 0x78U && heartbeat[3] == 0x12U, "uptime is little-endian");
+    static_assert(heartbeat[4] == 0x02U && heartbeat[5] == 0x03U && heartbeat[6] == 0xA5U, "");
+    expect_same_as_runtime(make_heartbeat(), heartbeat);
+
+    static constexpr auto fixed = nunavut::support::to_bytes(make_primitive_array_fixed());
+    expect_same_as_runtime(make_primitive_array_fixed(), fixed);
+}
+
+#endif  // NUNAVUT_SUPPORT_CONSTEXPR_SERIALIZATION
+
+static_assert(std::is_nothrow_move_constructible<regulated::basics::Struct__0_1>::value &&
+                  std::is_nothrow_move_assignable<regulated::basics::Struct__0_1>::value,
+              "Generated types have noexcept moves");
+static_assert(std::is_nothrow_move_constructible<regulated::basics::Union_0_1>::value &&
+                  std::is_nothrow_move_assignable<regulated::basics::Union_0_1>::value,
+              "So do unions, in both the C++14 and the std::variant flavour");
+static_assert(regulated::basics::Struct__0_1::IsTriviallyRelocatable,
+              "Variable-length arrays keep their elements on the heap and can be relocated");
+static_assert(nunavut::support::is_trivially_relocatable<regulated::basics::Union_0_1>::value, "");
+static_assert(nunavut::support::is_trivially_relocatable<
+                  std::array<regulated::basics::PrimitiveArrayVariable_0_1, 2>>::value, "");
+
+TEST(Serialization, StructRelocate)
+{
+    using namespace nunavut::support;
+    using T = regulated::basics::Struct__0_1;
+    T obj{};
+    obj.i10_4[2] = -7;
+    obj.f16_le2.push_back(0.5F);
+    obj.u2_le4.push_back(3);
+    obj.delimited_var_2[1].set_f64(-1e40);
+    uint8_t expected[T::SERIALIZATION_BUFFER_SIZE_BYTES]{};
+    const auto expected_result = obj.serialize(expected);
+    ASSERT_TRUE(expected_result) << "Error was " << expected_result.error();
+
+    std::aligned_storage<sizeof(T), alignof(T)>::type slot;
+    T* const          relocated = reinterpret_cast<T*>(&slot);
+    const float* const heap_data = obj.f16_le2.data();
+    relocate(relocated, &obj, 1U);
+    // Array elements on the heap stay where they are.
+    if (not decltype(obj.f16_le2)::has_inline_storage)
+    {
+        ASSERT_EQ(heap_data, relocated->f16_le2.data());
+    }
+    // obj is just memory now; it needs an object again before it goes out of scope.
+    new (&obj) T();
+
+    uint8_t actual[T::SERIALIZATION_BUFFER_SIZE_BYTES]{};
+    const auto actual_result = relocated->serialize(actual);
+    ASSERT_TRUE(actual_result) << "Error was " << actual_result.error();
+    ASSERT_EQ(expected_result.value(), actual_result.value());
+    ASSERT_EQ(0, std::memcmp(expected, actual, actual_result.value()));
+    relocated->~T();
+}
+
+TEST(Serialization, BufferPool)
+{
+    using namespace nunavut::support;
+    BufferPool<8U, 3U> pool;
+    const bytespan a = pool.acquire();
+    const bytespan b = pool.acquire();
+    const bytespan c = pool.acquire();
+    ASSERT_NE(nullptr, a.data());
+    ASSERT_NE(nullptr, b.data());
+    ASSERT_NE(nullptr, c.data());
+    ASSERT_EQ(8U, a.size());
+    ASSERT_NE(a.data(), b.data());
+    ASSERT_NE(b.data(), c.data());
+    ASSERT_EQ(nullptr, pool.acquire().data());
+    pool.release(b);
+    ASSERT_EQ(b.data(), pool.acquire().data());
+    pool.release(a);
+    pool.release(c);
+
+    // Messages are serialized into the smallest slot that fits them.
+    using T = regulated::basics::Struct__0_1;
+    static_assert(T::EXTENT_BYTES > 64U, "The test expects a large message");
+    BucketedBufferPool<1U, 64U, T::EXTENT_BYTES> buckets;
+    const std::size_t extent = T::EXTENT_BYTES;
+    T obj{};
+    ASSERT_LE(obj.serialized_size_bytes(), 64U);
+    const bytespan small = buckets.acquire(obj.serialized_size_bytes());
+    ASSERT_EQ(64U, small.size());
+    ASSERT_TRUE(obj.serialize({small.data(), small.size()}));
+    const bytespan spilled = buckets.acquire(obj.serialized_size_bytes());
+    ASSERT_EQ(extent, spilled.size());
+    ASSERT_EQ(nullptr, buckets.acquire(1U).data());
+    ASSERT_EQ(nullptr, buckets.acquire(extent + 1U).data());
+    buckets.release(small);
+    buckets.release(spilled);
+    ASSERT_EQ(extent, buckets.acquire(extent).size());
+    ASSERT_EQ(64U, buckets.acquire(1U).size());
+}
+
+TEST(Serialization, UnionDispatch)
+{
+    using Union = regulated::basics::Union_0_1;
+    for (std::size_t tag = 0U; tag < Union::VariantType::MAX_INDEX; ++tag)
+    {
+        Union obj{};
+        switch (tag)
+        {
+        case Union::VariantType::IndexOf::struct_:
+            obj.set_struct_().u16_2[1] = 0x1234;
+            break;
+        case Union::VariantType::IndexOf::delimited_fix_le2:
+            obj.set_delimited_fix_le2();
+            break;
+        default:
+            obj.set_delimited_var_le2().push_back();
+            obj.get_delimited_var_le2()[0].set_f32(-2.5F);
+            break;
+        }
+        uint8_t buf[Union::SERIALIZATION_BUFFER_SIZE_BYTES]{};
+        const auto result = obj.serialize(buf);
+        ASSERT_TRUE(result) << "Error was " << result.error();
+        ASSERT_EQ(tag, buf[0]);
+
+        // Copies and moves go through the same dispatch as serialization.
+        Union copy{obj};
+        ASSERT_EQ(tag, copy.union_value.index());
+        Union moved{std::move(copy)};
+        Union assigned{};
+        assigned = moved;
+        ASSERT_EQ(tag, assigned.union_value.index());
+
+        Union read{};
+        const auto read_result = read.deserialize({&buf[0], result.value()});
+        ASSERT_TRUE(read_result) << "Error was " << read_result.error();
+        ASSERT_EQ(tag, read.union_value.index());
+        uint8_t again[sizeof(buf)]{};
+        const auto again_result = assigned.serialize(again);
+        ASSERT_TRUE(again_result) << "Error was " << again_result.error();
+        ASSERT_EQ(result.value(), again_result.value());
+        ASSERT_EQ(0, std::memcmp(&buf[0], &again[0], result.value()));
+    }
+
+    const uint8_t bad_tag[] = {Union::VariantType::MAX_INDEX};
+    Union bad{};
+    const auto bad_result = bad.deserialize({&bad_tag[0], sizeof(bad_tag)});
+    ASSERT_FALSE(bad_result);
+    ASSERT_EQ(nunavut::support::Error::REPRESENTATION_BAD_UNION_TAG, bad_result.error());
+}
 
 TEST(Serialization, Primitive)
 {
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2023 UAVCAN Development Team.
+ * This software is distributed under the terms of the MIT License.
+ *
+ * Tests of the types generated with --enable-serialization-tracing, reporting to the CountingTracer of
+ * counting_tracer.hpp. The regulated test types are serialized out of line, so their records come from the generated
+ * source files linked into this test.
+ */
+
+#include "counting_tracer.hpp"
+#include "test_helpers.hpp"
+#include "regulated/basics/DelimitedVariableSize_0_1.hpp"
+#include "regulated/basics/Struct__0_1.hpp"
+#include "uavcan/node/Heartbeat_1_0.hpp"
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+using nunavut::support::TraceOperation;
+using nunavut::support::TraceRecord;
+
+std::uint64_t clock_ticks = 0U;
+std::vector<std::string> begun;
+std::vector<TraceRecord> records;
+std::vector<std::size_t> unaligned_copies;
+
+void reset()
+{
+    begun.clear();
+    records.clear();
+    unaligned_copies.clear();
+}
+
+std::size_t count(const char* type_name, TraceOperation operation)
+{
+    std::size_t result = 0U;
+    for (const auto& record : records)
+    {
+        if ((0 == std::strcmp(type_name, record.type_name)) && (operation == record.operation))
+        {
+            ++result;
+        }
+    }
+    return result;
+}
+
+regulated::basics::Struct__0_1 makeStruct()
+{
+    regulated::basics::Struct__0_1 obj{};
+    obj.boolean = true;
+    obj.i10_4[0] = 511;
+    obj.f16_le2.push_back(1.0F);
+    obj.delimited_var_2[0].set_f32(2.5F);
+    obj.delimited_var_2[1].set_f64(-1e40);
+    return obj;
+}
+
+}  // namespace
+
+std::uint64_t CountingTracer::now() noexcept
+{
+    return ++clock_ticks;
+}
+
+void CountingTracer::on_begin(TraceOperation, const char* type_name) noexcept
+{
+    begun.emplace_back(type_name);
+}
+
+void CountingTracer::on_end(const TraceRecord& record) noexcept
+{
+    records.push_back(record);
+}
+
+void CountingTracer::on_unaligned_copy(std::size_t length_bits) noexcept
+{
+    unaligned_copies.push_back(length_bits);
+}
+
+TEST(SerializationTracing, Serialize)
+{
+    const auto obj = makeStruct();
+    std::vector<uint8_t> buffer(regulated::basics::Struct__0_1::SERIALIZATION_BUFFER_SIZE_BYTES);
+    reset();
+    const auto result = obj.serialize({buffer.data(), buffer.size()});
+    ASSERT_TRUE(result) << "Error was " << result.error();
+
+    // The variable-size nested objects are reported as well, and end before the object holding them.
+    ASSERT_EQ(begun.size(), records.size());
+    ASSERT_EQ("regulated.basics.Struct_.0.1", begun.front());
+    ASSERT_EQ(1U, count("regulated.basics.Struct_.0.1", TraceOperation::Serialize));
+    ASSERT_EQ(2U, count("regulated.basics.DelimitedVariableSize.0.1", TraceOperation::Serialize));
+    const TraceRecord& last = records.back();
+    ASSERT_STREQ("regulated.basics.Struct_.0.1", last.type_name);
+    ASSERT_EQ(TraceOperation::Serialize, last.operation);
+    ASSERT_TRUE(last.result);
+    ASSERT_EQ(result.value(), last.result.value());
+    ASSERT_GT(last.ticks, 0U);
+}
+
+TEST(SerializationTracing, Deserialize)
+{
+    std::vector<uint8_t> buffer(regulated::basics::Struct__0_1::SERIALIZATION_BUFFER_SIZE_BYTES);
+    const auto serialized = makeStruct().serialize({buffer.data(), buffer.size()});
+    ASSERT_TRUE(serialized) << "Error was " << serialized.error();
+    buffer.resize(serialized.value());
+
+    regulated::basics::Struct__0_1 obj{};
+    reset();
+    const auto result = obj.deserialize({buffer.data(), buffer.size()});
+    ASSERT_TRUE(result) << "Error was " << result.error();
+    ASSERT_EQ(begun.size(), records.size());
+    ASSERT_EQ(1U, count("regulated.basics.Struct_.0.1", TraceOperation::Deserialize));
+    ASSERT_EQ(2U, count("regulated.basics.DelimitedVariableSize.0.1", TraceOperation::Deserialize));
+    ASSERT_EQ(0U, count("regulated.basics.Struct_.0.1", TraceOperation::Serialize));
+    ASSERT_EQ(buffer.size(), records.back().result.value());
+}
+
+TEST(SerializationTracing, ErrorsAreReported)
+{
+    std::vector<uint8_t> buffer(regulated::basics::Struct__0_1::SERIALIZATION_BUFFER_SIZE_BYTES);
+    const auto serialized = makeStruct().serialize({buffer.data(), buffer.size()});
+    ASSERT_TRUE(serialized) << "Error was " << serialized.error();
+    buffer[5] = static_cast<uint8_t>(buffer[5] | 0xFCU);  // The length of f16_le2, at bit 42, exceeds 2.
+
+    regulated::basics::Struct__0_1 obj{};
+    reset();
+    const auto result = obj.deserialize({buffer.data(), serialized.value()});
+    ASSERT_FALSE(result);
+    ASSERT_EQ(1U, records.size());
+    ASSERT_STREQ("regulated.basics.Struct_.0.1", records.back().type_name);
+    ASSERT_EQ(TraceOperation::Deserialize, records.back().operation);
+    ASSERT_FALSE(records.back().result);
+    ASSERT_EQ(nunavut::support::Error::REPRESENTATION_BAD_ARRAY_LENGTH, records.back().result.error());
+}
+
+TEST(SerializationTracing, InlineTypes)
+{
+    // The uavcan types are defined in their headers, which see the same tracer.
+    uavcan::node::Heartbeat_1_0 obj{};
+    uint8_t buffer[uavcan::node::Heartbeat_1_0::SERIALIZATION_BUFFER_SIZE_BYTES]{};
+    reset();
+    const auto result = obj.serialize(buffer);
+    ASSERT_TRUE(result) << "Error was " << result.error();
+    ASSERT_EQ(1U, records.size());
+    ASSERT_STREQ("uavcan.node.Heartbeat.1.0", records.back().type_name);
+    ASSERT_EQ(sizeof(buffer), records.back().result.value());
+}
+
+TEST(SerializationTracing, UnalignedCopies)
+{
+    const uint8_t src[4]{0x12, 0x34, 0x56, 0x78};
+    uint8_t dst[4]{};
+    reset();
+    nunavut::support::const_bitspan{src, sizeof(src), 0U}.copyTo(nunavut::support::bitspan{dst, sizeof(dst), 0U}, 24U);
+    ASSERT_TRUE(unaligned_copies.empty());
+    nunavut::support::const_bitspan{src, sizeof(src), 3U}.copyTo(nunavut::support::bitspan{dst, sizeof(dst), 0U}, 20U);
+    ASSERT_EQ(std::vector<std::size_t>{20U}, unaligned_copies);
+    ASSERT_TRUE(records.empty());
+}
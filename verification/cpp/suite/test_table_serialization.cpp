@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2023 UAVCAN Development Team.
+ * This software is distributed under the terms of the MIT License.
+ *
+ * Tests of the types serialized by the table interpreter, as generated with --table-serialization-types for the
+ * regulated.delimited and regulated.zubax namespaces.
+ */
+
+#include "test_helpers.hpp"
+#include "regulated/delimited/A_1_0.hpp"
+#include "regulated/delimited/BDelimited_1_0.hpp"
+#include "regulated/delimited/BDelimited_1_1.hpp"
+#include "regulated/zubax/actuator/esc/Status_0_1.hpp"
+
+#include <vector>
+
+namespace
+{
+
+using regulated::delimited::A_1_0;
+using regulated::delimited::BDelimited_1_0;
+using regulated::delimited::BDelimited_1_1;
+using regulated::zubax::actuator::esc::Status_0_1;
+
+template <typename T>
+std::vector<uint8_t> serialize(const T& obj)
+{
+    std::vector<uint8_t> buffer(T::SERIALIZATION_BUFFER_SIZE_BYTES);
+    const auto result = obj.serialize({buffer.data(), buffer.size()});
+    EXPECT_TRUE(result) << "Error was " << result.error();
+    buffer.resize(result ? result.value() : 0U);
+    return buffer;
+}
+
+BDelimited_1_0 makeDelimited()
+{
+    BDelimited_1_0 obj{};
+    obj.var.push_back();
+    obj.var[0].a.push_back(1U);
+    obj.var[0].a.push_back(2U);
+    obj.var[0].b = -3;
+    obj.fix.push_back();
+    obj.fix[0].a = {5U, 6U};
+    return obj;
+}
+
+}  // namespace
+
+TEST(TableSerialization, TypesInTheNamespacesAreTableDriven)
+{
+    ASSERT_NE(nullptr, BDelimited_1_0::serialization_table().fields);
+    ASSERT_EQ(2U, BDelimited_1_0::serialization_table().field_count);
+    ASSERT_NE(nullptr, Status_0_1::serialization_table().fields);
+}
+
+TEST(TableSerialization, NestedDelimitedArrays)
+{
+    const BDelimited_1_0 obj = makeDelimited();
+    const std::vector<uint8_t> expected{
+        0x01,                                           // var: one element
+        0x04, 0x00, 0x00, 0x00, 0x02, 0x01, 0x02, 0xFD, // var[0]: delimiter header, a, b
+        0x01,                                           // fix: one element
+        0x02, 0x00, 0x00, 0x00, 0x05, 0x06,             // fix[0]: delimiter header, a
+    };
+    ASSERT_EQ(expected, serialize(obj));
+    ASSERT_EQ(expected.size(), obj.serialized_size_bytes());
+
+    BDelimited_1_0 back{};
+    const auto result = back.deserialize({expected.data(), expected.size()});
+    ASSERT_TRUE(result) << "Error was " << result.error();
+    ASSERT_EQ(expected.size(), result.value());
+    ASSERT_EQ(expected, serialize(back));
+
+    // A buffer that holds this object is enough even though it is smaller than SERIALIZATION_BUFFER_SIZE_BYTES.
+    std::vector<uint8_t> exact(expected.size());
+    ASSERT_TRUE(obj.serialize({exact.data(), exact.size()}));
+    const auto too_small = obj.serialize({exact.data(), exact.size() - 1U});
+    ASSERT_FALSE(too_small);
+    ASSERT_EQ(nunavut::support::Error::SERIALIZATION_BUFFER_TOO_SMALL, too_small.error());
+}
+
+TEST(TableSerialization, NewerVersionIsReadAsOlder)
+{
+    BDelimited_1_1 newer{};
+    newer.var.push_back();
+    newer.var[0].a.push_back(7U);
+    newer.fix.push_back();
+    newer.fix[0].a = {1U, 2U, 3U};
+    newer.fix[0].b = -1;
+    const auto buffer = serialize(newer);
+
+    // The fields the older version does not know about are skipped using the delimiter headers.
+    BDelimited_1_0 older{};
+    const auto result = older.deserialize({buffer.data(), buffer.size()});
+    ASSERT_TRUE(result) << "Error was " << result.error();
+    ASSERT_EQ(buffer.size(), result.value());
+    ASSERT_EQ(1U, older.var.size());
+    ASSERT_EQ(1U, older.var[0].a.size());
+    ASSERT_EQ(7U, older.var[0].a[0]);
+    ASSERT_EQ(1U, older.fix.size());
+    ASSERT_EQ(1U, older.fix[0].a[0]);
+    ASSERT_EQ(2U, older.fix[0].a[1]);
+}
+
+TEST(TableSerialization, BadInput)
+{
+    auto buffer = serialize(makeDelimited());
+    BDelimited_1_0 obj{};
+
+    buffer[1] = 0xFF;  // The delimiter header of var[0] points past the end.
+    auto result = obj.deserialize({buffer.data(), buffer.size()});
+    ASSERT_FALSE(result);
+    ASSERT_EQ(nunavut::support::Error::REPRESENTATION_BAD_DELIMITER_HEADER, result.error());
+
+    buffer[0] = 3U;  // var holds two elements at most.
+    result = obj.deserialize({buffer.data(), buffer.size()});
+    ASSERT_FALSE(result);
+    ASSERT_EQ(nunavut::support::Error::REPRESENTATION_BAD_ARRAY_LENGTH, result.error());
+}
+
+TEST(TableSerialization, FieldMask)
+{
+    const auto buffer = serialize(makeDelimited());
+    BDelimited_1_0 obj{};
+    BDelimited_1_0::FieldMask mask{};
+    mask.fix = true;
+    const auto result = obj.deserialize({buffer.data(), buffer.size()}, mask);
+    ASSERT_TRUE(result) << "Error was " << result.error();
+    ASSERT_EQ(buffer.size(), result.value());
+    ASSERT_TRUE(obj.var.empty());
+    ASSERT_EQ(1U, obj.fix.size());
+    ASSERT_EQ(6U, obj.fix[0].a[1]);
+}
+
+TEST(TableSerialization, FieldMaskBadInput)
+{
+    // The fields that are skipped are checked as well.
+    auto buffer = serialize(makeDelimited());
+    BDelimited_1_0 obj{};
+    BDelimited_1_0::FieldMask mask{};
+    mask.fix = true;
+
+    buffer[1] = 0xFF;  // The delimiter header of var[0] points past the end.
+    auto result = obj.deserialize({buffer.data(), buffer.size()}, mask);
+    ASSERT_FALSE(result);
+    ASSERT_EQ(nunavut::support::Error::REPRESENTATION_BAD_DELIMITER_HEADER, result.error());
+
+    buffer[0] = 3U;  // var holds two elements at most.
+    result = obj.deserialize({buffer.data(), buffer.size()}, mask);
+    ASSERT_FALSE(result);
+    ASSERT_EQ(nunavut::support::Error::REPRESENTATION_BAD_ARRAY_LENGTH, result.error());
+}
+
+TEST(TableSerialization, UnionHoldingTableDrivenTypes)
+{
+    // Unions keep the unrolled code and call the interpreter for their table-driven alternatives.
+    A_1_0 obj{};
+    (void) obj.set_del(makeDelimited());
+    const auto buffer = serialize(obj);
+    ASSERT_EQ(obj.serialized_size_bytes(), buffer.size());
+
+    A_1_0 back{};
+    const auto result = back.deserialize({buffer.data(), buffer.size()});
+    ASSERT_TRUE(result) << "Error was " << result.error();
+    ASSERT_TRUE(back.is_del());
+    ASSERT_EQ(serialize(makeDelimited()), serialize(back.get_del()));
+}
+
+TEST(TableSerialization, SaturationAndNestedTypes)
+{
+    Status_0_1 obj{};
+    obj.index = 100U;  // uint6 saturates to 63.
+    obj.demand_factor = 42U;
+    obj.overload_warning = true;
+    obj.error_count = 0x01020304UL;
+    obj.motor_torque.newton_meter = 1.5F;
+    obj.dc_link_power.voltage.volt = 48.0F;
+    obj.motor_temperature = 1.0e6F;  // float16 saturates to 65504.
+    const auto buffer = serialize(obj);
+    ASSERT_EQ(Status_0_1::SERIALIZATION_BUFFER_SIZE_BYTES, buffer.size());
+    ASSERT_EQ(63U, buffer[0]);
+    ASSERT_EQ(42U, buffer[1]);
+    ASSERT_EQ(0x02U, buffer[2]);
+    ASSERT_EQ(0x04U, buffer[4]);
+
+    Status_0_1 back{};
+    const auto result = back.deserialize({buffer.data(), buffer.size()});
+    ASSERT_TRUE(result) << "Error was " << result.error();
+    ASSERT_EQ(63U, back.index);
+    ASSERT_TRUE(back.overload_warning);
+    ASSERT_FALSE(back.dc_voltage_warning);
+    ASSERT_EQ(0x01020304UL, back.error_count);
+    ASSERT_FLOAT_EQ(1.5F, back.motor_torque.newton_meter);
+    ASSERT_FLOAT_EQ(48.0F, back.dc_link_power.voltage.volt);
+    ASSERT_FLOAT_EQ(65504.0F, back.motor_temperature);
+}
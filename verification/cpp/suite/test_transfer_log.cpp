@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2022 UAVCAN Development Team.
+ * This software is distributed under the terms of the MIT License.
+ *
+ * Tests of the transfer log reader
+ */
+
+#include "test_helpers.hpp"
+#include "nunavut/support/transfer_log.hpp"
+#include "uavcan/node/Heartbeat_1_0.hpp"
+
+#include <cstdio>
+#include <vector>
+
+namespace
+{
+
+/// A log of @p count heartbeats with an uptime equal to their index.
+std::vector<uint8_t> make_log(const uint32_t count)
+{
+    std::vector<uint8_t> log;
+    for (uint32_t i = 0U; i < count; ++i)
+    {
+        uavcan::node::Heartbeat_1_0 msg{};
+        msg.uptime = i;
+        std::array<uint8_t, uavcan::node::Heartbeat_1_0::SERIALIZATION_BUFFER_SIZE_BYTES> buffer{};
+        const auto size = msg.serialize(buffer).value();
+        for (unsigned shift = 0U; shift < 32U; shift += 8U)
+        {
+            log.push_back(static_cast<uint8_t>(size >> shift));
+        }
+        log.insert(log.end(), buffer.begin(), buffer.begin() + static_cast<std::ptrdiff_t>(size));
+    }
+    return log;
+}
+
+} // namespace
+
+TEST(TransferLog, ReadsEveryRecord)
+{
+    using namespace nunavut::support;
+    const std::vector<uint8_t> log = make_log(3U);
+    TransferLogReader reader{{log.data(), log.size()}};
+    uint32_t count = 0U;
+    while (not reader.at_end())
+    {
+        const auto record = reader.next();
+        ASSERT_TRUE(record) << "Error was " << record.error();
+        ASSERT_EQ(uavcan::node::Heartbeat_1_0::SERIALIZATION_BUFFER_SIZE_BYTES * 8U, record.value().size());
+        uavcan::node::Heartbeat_1_0 msg{};
+        ASSERT_TRUE(msg.deserialize(record.value()));
+        ASSERT_EQ(count, msg.uptime);
+        ++count;
+    }
+    ASSERT_EQ(3U, count);
+    ASSERT_EQ(log.size(), reader.offset());
+
+    // Seeking back replays from the record there.
+    reader.seek(TransferLogReader::PrefixSizeBytes + uavcan::node::Heartbeat_1_0::SERIALIZATION_BUFFER_SIZE_BYTES);
+    uavcan::node::Heartbeat_1_0 msg{};
+    ASSERT_TRUE(msg.deserialize(reader.next().value()));
+    ASSERT_EQ(1U, msg.uptime);
+}
+
+TEST(TransferLog, TruncatedRecord)
+{
+    using namespace nunavut::support;
+    std::vector<uint8_t> log = make_log(2U);
+    log.pop_back();
+    TransferLogReader reader{{log.data(), log.size()}};
+    ASSERT_TRUE(reader.next());
+    const auto offset = reader.offset();
+    const auto record = reader.next();
+    ASSERT_FALSE(record);
+    ASSERT_EQ(Error::REPRESENTATION_BAD_DELIMITER_HEADER, record.error());
+    ASSERT_EQ(offset, reader.offset());
+
+    // Not even the length prefix is complete.
+    TransferLogReader short_reader{{log.data(), 2U}};
+    ASSERT_FALSE(short_reader.next());
+}
+
+#if NUNAVUT_SUPPORT_TRANSFER_LOG_MMAP
+
+TEST(TransferLog, MappedFile)
+{
+    using namespace nunavut::support;
+    const std::vector<uint8_t> log = make_log(100U);
+    char path[] = "/tmp/nunavut_transfer_log_XXXXXX";
+    const int fd = ::mkstemp(path);
+    ASSERT_LE(0, fd);
+    ASSERT_EQ(static_cast<ssize_t>(log.size()), ::write(fd, log.data(), log.size()));
+    ASSERT_EQ(0, ::close(fd));
+    {
+        MappedFile file{path};
+        ASSERT_TRUE(file.is_open()) << "errno was " << file.error_number();
+        ASSERT_EQ(log.size(), file.bytes().size());
+        ASSERT_TRUE(file.will_need(1000U, 100000U));
+        ASSERT_FALSE(file.will_need(log.size(), 1U));
+
+        TransferLogReader reader{file.bytes()};
+        uint32_t count = 0U;
+        while (not reader.at_end())
+        {
+            uavcan::node::Heartbeat_1_0 msg{};
+            ASSERT_TRUE(msg.deserialize(reader.next().value()));
+            ASSERT_EQ(count, msg.uptime);
+            ++count;
+        }
+        ASSERT_EQ(100U, count);
+
+        MappedFile moved{std::move(file)};
+        ASSERT_EQ(log.size(), moved.bytes().size());
+        ASSERT_EQ(0U, file.bytes().size());
+    }
+    ASSERT_EQ(0, std::remove(path));
+}
+
+TEST(TransferLog, MappedFileEmptyOrMissing)
+{
+    using namespace nunavut::support;
+    char path[] = "/tmp/nunavut_transfer_log_XXXXXX";
+    const int fd = ::mkstemp(path);
+    ASSERT_LE(0, fd);
+    ASSERT_EQ(0, ::close(fd));
+    {
+        const MappedFile file{path, MappedFile::Access::Random};
+        ASSERT_TRUE(file.is_open());
+        ASSERT_EQ(0U, file.bytes().size());
+        ASSERT_TRUE(TransferLogReader{file.bytes()}.at_end());
+    }
+    ASSERT_EQ(0, std::remove(path));
+
+    const MappedFile missing{path};
+    ASSERT_FALSE(missing.is_open());
+    ASSERT_EQ(ENOENT, missing.error_number());
+    ASSERT_EQ(0U, missing.bytes().size());
+}
+
+#endif // NUNAVUT_SUPPORT_TRANSFER_LOG_MMAP
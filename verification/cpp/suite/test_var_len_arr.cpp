@@ -226,6 +226,53 @@ TYPED_TEST(VLATestsGeneric, TestPush)
     }
 }
 
+TYPED_TEST(VLATestsGeneric, TestResizeForOverwrite)
+{
+    using value_type = typename TypeParam::value_type;
+    nunavut::support::VariableLengthArray<value_type, VLATestsGeneric_MinMaxSize, TypeParam> subject;
+    subject.push_back(static_cast<value_type>(42));
+
+    ASSERT_EQ(VLATestsGeneric_MinMaxSize, subject.resize_for_overwrite(VLATestsGeneric_MinMaxSize));
+    ASSERT_EQ(VLATestsGeneric_MinMaxSize, subject.size());
+    ASSERT_EQ(VLATestsGeneric_MinMaxSize, subject.capacity());
+    ASSERT_EQ(static_cast<value_type>(42), subject[0]);
+    for (std::size_t i = 0; i < subject.size(); ++i)
+    {
+        subject[i] = static_cast<value_type>(i);
+    }
+
+    ASSERT_EQ(3U, subject.resize_for_overwrite(3));
+    ASSERT_EQ(3U, subject.size());
+    ASSERT_EQ(VLATestsGeneric_MinMaxSize, subject.capacity());
+    ASSERT_EQ(static_cast<value_type>(2), subject[2]);
+
+    ASSERT_THROW(subject.resize_for_overwrite(VLATestsGeneric_MinMaxSize + 1), std::length_error);
+    ASSERT_EQ(3U, subject.size());
+}
+
+TYPED_TEST(VLATestsGeneric, TestAppend)
+{
+    using value_type = typename TypeParam::value_type;
+    nunavut::support::VariableLengthArray<value_type, VLATestsGeneric_MinMaxSize, TypeParam> subject;
+    std::array<value_type, VLATestsGeneric_MinMaxSize> source{};
+    for (std::size_t i = 0; i < source.size(); ++i)
+    {
+        source[i] = static_cast<value_type>(i + 1);
+    }
+
+    ASSERT_EQ(0U, subject.append(source.data(), 0));
+    ASSERT_EQ(0U, subject.size());
+    ASSERT_EQ(2U, subject.append(source.data(), 2));
+    ASSERT_EQ(VLATestsGeneric_MinMaxSize - 2, subject.append(source.data(), VLATestsGeneric_MinMaxSize - 2));
+    ASSERT_EQ(VLATestsGeneric_MinMaxSize, subject.size());
+    ASSERT_EQ(static_cast<value_type>(2), subject[1]);
+    ASSERT_EQ(static_cast<value_type>(1), subject[2]);
+    ASSERT_EQ(source[VLATestsGeneric_MinMaxSize - 3], subject[VLATestsGeneric_MinMaxSize - 1]);
+
+    ASSERT_THROW(subject.append(source.data(), 1), std::length_error);
+    ASSERT_EQ(VLATestsGeneric_MinMaxSize, subject.size());
+}
+
 TYPED_TEST(VLATestsGeneric, TestPop)
 {
     static_assert(20 < VLATestsGeneric_MinMaxSize,
@@ -553,6 +600,31 @@ TEST(VLATestsNonTrivial, TestMoveAssignment)
     ASSERT_EQ(std::string("three"), lhs[0]);
 }
 
+TEST(VLATestsNonTrivial, TestResizeForOverwrite)
+{
+    nunavut::support::VariableLengthArray<std::string, 5> subject;
+    subject.push_back("one");
+    ASSERT_EQ(3U, subject.resize_for_overwrite(3));
+    ASSERT_EQ(std::string("one"), subject[0]);
+    // Non-trivial elements are value-initialized.
+    ASSERT_TRUE(subject[1].empty());
+    ASSERT_TRUE(subject[2].empty());
+    ASSERT_EQ(1U, subject.resize_for_overwrite(1));
+    ASSERT_EQ(std::string("one"), subject[0]);
+}
+
+TEST(VLATestsNonTrivial, TestAppend)
+{
+    const std::array<std::string, 2>                    source{"one", "two"};
+    nunavut::support::VariableLengthArray<std::string, 5> subject;
+    subject.push_back("zero");
+    ASSERT_EQ(2U, subject.append(source.data(), source.size()));
+    ASSERT_EQ(3U, subject.size());
+    ASSERT_EQ(std::string("zero"), subject[0]);
+    ASSERT_EQ(std::string("two"), subject[2]);
+    ASSERT_EQ(std::string("two"), source[1]);
+}
+
 TEST(VLATestsNonTrivial, TestPushBackGrowsCapacity)
 {
     static constexpr std::size_t                        MaxSize = 5;
@@ -561,3 +633,207 @@ TEST(VLATestsNonTrivial, TestPushBackGrowsCapacity)
     subject.push_back();
     ASSERT_LE(1U, subject.capacity());
 }
+
+// +----------------------------------------------------------------------+
+// | MonotonicArena
+// +----------------------------------------------------------------------+
+
+TEST(VLATestsArena, TestFixedBufferArena)
+{
+    nunavut::support::FixedBufferArena<64> arena;
+    ASSERT_EQ(64U, arena.capacity());
+    ASSERT_EQ(0U, arena.used());
+    void* const one_byte = arena.allocate(1, 1);
+    ASSERT_NE(nullptr, one_byte);
+    void* const aligned = arena.allocate(8, 8);
+    ASSERT_NE(nullptr, aligned);
+    ASSERT_EQ(0U, reinterpret_cast<std::uintptr_t>(aligned) % 8U);
+    ASSERT_EQ(16U, arena.used());
+    ASSERT_EQ(nullptr, arena.allocate(64, 1));
+    ASSERT_EQ(16U, arena.used());
+    arena.release();
+    ASSERT_EQ(0U, arena.used());
+    ASSERT_EQ(one_byte, arena.allocate(64, 1));
+    ASSERT_EQ(nullptr, arena.allocate(1, 1));
+}
+
+TEST(VLATestsArena, TestArraysShareArena)
+{
+    using Allocator  = nunavut::support::MonotonicArenaAllocator<std::uint32_t>;
+    using ArrayType  = nunavut::support::VariableLengthArray<std::uint32_t, 8, Allocator>;
+    nunavut::support::FixedBufferArena<128> arena;
+    ArrayType                               first{Allocator(arena)};
+    ArrayType                               second{Allocator(arena)};
+    ASSERT_EQ(&arena, first.get_allocator().arena());
+    ASSERT_EQ(4U, first.resize_for_overwrite(4));
+    ASSERT_EQ(8U, second.resize_for_overwrite(8));
+    ASSERT_EQ(12U * sizeof(std::uint32_t), arena.used());
+    first[3]  = 0xCAFEU;
+    second[7] = 0xBEEFU;
+    ASSERT_EQ(0xCAFEU, first[3]);
+    ASSERT_EQ(0xBEEFU, second[7]);
+    // Copies stay in the same arena.
+    const ArrayType copy = second;
+    ASSERT_EQ(&arena, copy.get_allocator().arena());
+    ASSERT_EQ(20U * sizeof(std::uint32_t), arena.used());
+    ASSERT_EQ(0xBEEFU, copy[7]);
+}
+
+TEST(VLATestsArena, TestUnboundAllocatorUsesHeap)
+{
+    using Allocator = nunavut::support::MonotonicArenaAllocator<std::string>;
+    nunavut::support::VariableLengthArray<std::string, 4, Allocator> subject;
+    ASSERT_EQ(nullptr, subject.get_allocator().arena());
+    subject.push_back("one");
+    subject.push_back("two");
+    ASSERT_EQ(2U, subject.size());
+    ASSERT_EQ(std::string("two"), subject[1]);
+}
+
+TEST(VLATestsArena, TestRebindToArena)
+{
+    using Allocator = nunavut::support::MonotonicArenaAllocator<std::uint8_t>;
+    using ArrayType = nunavut::support::VariableLengthArray<std::uint8_t, 16, Allocator>;
+    nunavut::support::FixedBufferArena<16> arena;
+    ArrayType                              subject;
+    subject.push_back(1);
+    // This is how generated deserialize(in_buffer, arena) moves members into the arena.
+    subject = ArrayType(Allocator(arena));
+    ASSERT_EQ(0U, subject.size());
+    ASSERT_EQ(&arena, subject.get_allocator().arena());
+    ASSERT_EQ(16U, subject.resize_for_overwrite(16));
+    ASSERT_EQ(16U, arena.used());
+}
+
+TEST(VLATestsArena, TestArenaExhausted)
+{
+    using Allocator = nunavut::support::MonotonicArenaAllocator<std::uint64_t>;
+    nunavut::support::FixedBufferArena<16>                               arena;
+    nunavut::support::VariableLengthArray<std::uint64_t, 4, Allocator> subject{Allocator(arena)};
+    ASSERT_EQ(2U, subject.resize_for_overwrite(2));
+#if __cpp_exceptions
+    ASSERT_THROW(subject.resize_for_overwrite(4), std::bad_alloc);
+#else
+    ASSERT_EQ(2U, subject.resize_for_overwrite(4));
+#endif
+    arena.release();
+    ASSERT_EQ(0U, arena.used());
+}
+
+// +----------------------------------------------------------------------+
+// | InlineVariableLengthArray
+// +----------------------------------------------------------------------+
+
+TEST(VLATestsInline, TestStorageIsInline)
+{
+    nunavut::support::InlineVariableLengthArray<std::uint16_t, 4> subject;
+    ASSERT_EQ(0U, subject.size());
+    ASSERT_EQ(4U, subject.capacity());
+    ASSERT_EQ(4U, subject.reserve(1));
+    const auto* const object_begin = reinterpret_cast<const std::uint8_t*>(&subject);
+    const auto* const data_begin   = reinterpret_cast<const std::uint8_t*>(subject.data());
+    ASSERT_LE(object_begin, data_begin);
+    ASSERT_LT(data_begin, object_begin + sizeof(subject));
+    for (std::uint16_t i = 0; i < 4; ++i)
+    {
+        subject.push_back(i);
+    }
+    ASSERT_EQ(4U, subject.size());
+    ASSERT_EQ(3U, subject[3]);
+#if __cpp_exceptions
+    ASSERT_THROW(subject.push_back(4), std::length_error);
+    ASSERT_THROW(subject.resize_for_overwrite(5), std::length_error);
+#else
+    subject.push_back(4);
+    ASSERT_EQ(4U, subject.resize_for_overwrite(5));
+#endif
+    ASSERT_EQ(4U, subject.size());
+    ASSERT_TRUE(subject.shrink_to_fit());
+    ASSERT_EQ(4U, subject.capacity());
+}
+
+TEST(VLATestsInline, TestTriviallyCopyable)
+{
+    using ArrayType = nunavut::support::InlineVariableLengthArray<std::uint8_t, 16>;
+    static_assert(std::is_trivially_copyable<ArrayType>::value, "Arrays of trivial elements can be memcpy'd");
+    static_assert(!std::is_trivially_copyable<nunavut::support::InlineVariableLengthArray<std::string, 2>>::value,
+                  "");
+    ArrayType subject{{1, 2, 3}};
+    ArrayType copy = subject;
+    ASSERT_EQ(subject, copy);
+    ArrayType relocated;
+    std::memcpy(&relocated, &subject, sizeof(subject));
+    ASSERT_EQ(3U, relocated.size());
+    ASSERT_EQ(3U, relocated[2]);
+    ASSERT_NE(subject.data(), relocated.data());
+}
+
+TEST(VLATestsInline, TestNonTrivial)
+{
+    using ArrayType = nunavut::support::InlineVariableLengthArray<std::string, 3>;
+    ArrayType subject{{std::string("one"), std::string("two")}};
+    ArrayType copy(subject);
+    ASSERT_EQ(subject, copy);
+    ArrayType moved(std::move(subject));
+    ASSERT_EQ(0U, subject.size());
+    ASSERT_EQ(copy, moved);
+    subject = moved;
+    ASSERT_EQ(std::string("two"), subject[1]);
+    const std::array<std::string, 1> source{"three"};
+    ASSERT_EQ(1U, moved.append(source.data(), source.size()));
+#if __cpp_exceptions
+    ASSERT_THROW(moved.append(source.data(), source.size()), std::length_error);
+#else
+    ASSERT_EQ(0U, moved.append(source.data(), source.size()));
+#endif
+    ASSERT_EQ(std::string("three"), moved[2]);
+    ASSERT_EQ(2U, moved.resize_for_overwrite(2));
+    ASSERT_EQ(3U, moved.resize_for_overwrite(3));
+    ASSERT_TRUE(moved[2].empty());
+}
+
+TEST(VLATestsInline, TestDestroy)
+{
+    int dtor_called = 0;
+    {
+        nunavut::support::InlineVariableLengthArray<Doomed, 2> subject;
+        subject.push_back(Doomed(&dtor_called));
+        subject.push_back(Doomed(&dtor_called));
+        subject.pop_back();
+        ASSERT_EQ(1, dtor_called);
+    }
+    ASSERT_EQ(2, dtor_called);
+}
+
+TEST(VLATestsInline, TestSmallVariableLengthArray)
+{
+    using nunavut::support::InlineVariableLengthArray;
+    using nunavut::support::SmallVariableLengthArray;
+    using nunavut::support::VariableLengthArray;
+    static_assert(std::is_same<SmallVariableLengthArray<std::uint8_t, 31, 32>,
+                               InlineVariableLengthArray<std::uint8_t, 31>>::value,
+                  "Arrays smaller than the threshold are inline");
+    static_assert(std::is_same<SmallVariableLengthArray<std::uint8_t, 32, 32>,
+                               VariableLengthArray<std::uint8_t, 32>>::value,
+                  "Other arrays are allocated");
+    static_assert(std::is_same<SmallVariableLengthArray<std::uint32_t, 8, 32>,
+                               VariableLengthArray<std::uint32_t, 8>>::value,
+                  "The threshold is in bytes");
+    static_assert(SmallVariableLengthArray<std::uint8_t, 4, 32>::has_inline_storage, "");
+    static_assert(!SmallVariableLengthArray<std::uint8_t, 64, 32>::has_inline_storage, "");
+}
+
+TEST(VLATestsInline, TestIsTriviallyRelocatable)
+{
+    using nunavut::support::InlineVariableLengthArray;
+    using nunavut::support::VariableLengthArray;
+    static_assert(VariableLengthArray<std::string, 4>::IsTriviallyRelocatable, "The elements are on the heap");
+    static_assert(VariableLengthArray<int, 4, nunavut::support::MonotonicArenaAllocator<int>>::IsTriviallyRelocatable,
+                  "The arena is not part of the allocator");
+    static_assert(!VariableLengthArray<int, 10, JunkyStaticAllocator<int, 10>>::IsTriviallyRelocatable,
+                  "The elements may be inside a stateful allocator");
+    static_assert(InlineVariableLengthArray<int, 4>::IsTriviallyRelocatable, "");
+    static_assert(!InlineVariableLengthArray<std::string, 4>::IsTriviallyRelocatable,
+                  "Inline arrays are as relocatable as their elements");
+    static_assert(InlineVariableLengthArray<VariableLengthArray<int, 4>, 2>::IsTriviallyRelocatable, "");
+}
@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) 2023 UAVCAN Development Team.
+ * This software is distributed under the terms of the MIT License.
+ *
+ * Tests of the View types and the stream state machines, generated with --enable-view-types and
+ * --enable-stream-serialization.
+ */
+
+#include "test_helpers.hpp"
+#include "regulated/basics/DelimitedVariableSize_0_1.hpp"
+#include "regulated/basics/Struct__0_1.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+TEST(View, Struct)
+{
+    regulated::basics::Struct__0_1 obj{};
+    obj.boolean  = true;
+    obj.i10_4[2] = +0x0055;
+    obj.f16_le2.push_back(-1.0F);
+    obj.bytes_lt3.push_back(111);
+    obj.bytes_lt3.push_back(222);
+    obj.bytes_3[0] = -0x77;
+    obj.bytes_3[2] = +0x77;
+    obj.u2_le4.push_back(0x02);
+    obj.delimited_fix_le2.push_back();
+    obj.u16_2[0] = 0x1234;
+    obj.u16_2[1] = 0x5678;
+    obj.delimited_var_2[1].set_f64(-1e40);
+    obj.aligned_bitpacked_le3.push_back(true);
+
+    uint8_t buf[regulated::basics::Struct__0_1::SERIALIZATION_BUFFER_SIZE_BYTES]{};
+    const auto result = obj.serialize(buf);
+    ASSERT_TRUE(result) << "Error was " << result.error();
+
+    const regulated::basics::Struct__0_1::View view{nunavut::support::const_bitspan{&buf[0], result.value()}};
+    ASSERT_EQ(result.value() * 8U, view.extent_bits());
+    ASSERT_TRUE(view.boolean());
+
+    // Byte arrays alias the buffer.
+    const auto bytes_lt3 = view.bytes_lt3();
+    ASSERT_EQ(2U, bytes_lt3.size());
+    ASSERT_EQ(111, bytes_lt3[0]);
+    ASSERT_EQ(222, bytes_lt3[1]);
+    ASSERT_GE(bytes_lt3.data(), &buf[0]);
+    ASSERT_LT(bytes_lt3.data(), &buf[0] + result.value());
+    const auto bytes_3 = view.bytes_3();
+    ASSERT_EQ(3U, bytes_3.size());
+    ASSERT_EQ(-0x77, bytes_3[0]);
+    ASSERT_EQ(0, bytes_3[1]);
+    ASSERT_EQ(+0x77, bytes_3[2]);
+
+    // Everything else is decoded on access, including fields that follow variable-length ones.
+    std::array<std::uint16_t, 2> u16_2{};
+    ASSERT_TRUE(view.u16_2(u16_2));
+    ASSERT_EQ(0x1234, u16_2[0]);
+    ASSERT_EQ(0x5678, u16_2[1]);
+    std::array<std::int16_t, 4> i10_4{};
+    ASSERT_TRUE(view.i10_4(i10_4));
+    ASSERT_EQ(+0x55, i10_4[2]);
+    decltype(obj.f16_le2) f16_le2;
+    ASSERT_TRUE(view.f16_le2(f16_le2));
+    ASSERT_EQ(1U, f16_le2.size());
+    ASSERT_FLOAT_EQ(-1.0F, f16_le2[0]);
+    decltype(obj.aligned_bitpacked_le3) aligned_bitpacked_le3;
+    ASSERT_TRUE(view.aligned_bitpacked_le3(aligned_bitpacked_le3));
+    ASSERT_EQ(1U, aligned_bitpacked_le3.size());
+    ASSERT_TRUE(aligned_bitpacked_le3[0]);
+    decltype(obj.delimited_var_2) delimited_var_2;
+    ASSERT_TRUE(view.delimited_var_2(delimited_var_2));
+    ASSERT_EQ(2U, delimited_var_2[1].union_value.index());
+
+    // Views of a truncated buffer follow the implicit zero extension rule just like deserialize() does.
+    for (std::size_t length = 0U; length <= result.value(); ++length)
+    {
+        regulated::basics::Struct__0_1 reference{};
+        if (not reference.deserialize({&buf[0], length}))
+        {
+            continue;  // E.g. a delimiter header pointing past the end; views do not validate the representation.
+        }
+        const regulated::basics::Struct__0_1::View truncated{nunavut::support::const_bitspan{&buf[0], length}};
+        ASSERT_TRUE(truncated.u16_2(u16_2));
+        ASSERT_EQ(reference.u16_2[0], u16_2[0]) << "length " << length;
+        ASSERT_EQ(reference.u16_2[1], u16_2[1]) << "length " << length;
+        ASSERT_EQ(reference.boolean, truncated.boolean());
+        ASSERT_LE(truncated.bytes_lt3().size(), reference.bytes_lt3.size());
+    }
+}
+
+TEST(View, Union)
+{
+    regulated::basics::DelimitedVariableSize_0_1 obj{};
+    obj.set_f32(1.5F);
+    uint8_t buf[regulated::basics::DelimitedVariableSize_0_1::SERIALIZATION_BUFFER_SIZE_BYTES]{};
+    const auto result = obj.serialize(buf);
+    ASSERT_TRUE(result) << "Error was " << result.error();
+
+    const regulated::basics::DelimitedVariableSize_0_1::View view{nunavut::support::const_bitspan{&buf[0], result.value()}};
+    const std::size_t f32_index = regulated::basics::DelimitedVariableSize_0_1::VariantType::IndexOf::f32;
+    ASSERT_EQ(f32_index, view.union_tag());
+    ASSERT_FLOAT_EQ(1.5F, view.f32());
+    ASSERT_EQ(result.value() * 8U, view.extent_bits());
+}
+
+TEST(Streaming, Struct)
+{
+    using namespace nunavut::support;
+    regulated::basics::Struct__0_1 obj{};
+    obj.boolean = true;
+    obj.i10_4[0] = 0x5555;
+    obj.i10_4[3] = -0x22;
+    obj.f16_le2.push_back(-1.0F);
+    obj.unaligned_bitpacked_3[0] = true;
+    obj.bytes_lt3.push_back(111);
+    obj.bytes_lt3.push_back(222);
+    obj.bytes_3[2] = -2;
+    obj.u2_le4.push_back(0x02);
+    obj.u2_le4.push_back(0x01);
+    obj.delimited_fix_le2.push_back();
+    obj.u16_2[0] = 0x1234;
+    obj.u16_2[1] = 0x5678;
+    obj.aligned_bitpacked_3[1] = true;
+    obj.unaligned_bitpacked_lt3.push_back(true);
+    obj.unaligned_bitpacked_lt3.push_back(false);
+    obj.delimited_var_2[0].set_f16(+1e9F);
+    obj.delimited_var_2[1].set_f64(-1e40);
+    obj.aligned_bitpacked_le3.push_back(true);
+
+    uint8_t contiguous[regulated::basics::Struct__0_1::SERIALIZATION_BUFFER_SIZE_BYTES]{};
+    const auto result = obj.serialize(contiguous);
+    ASSERT_TRUE(result) << "Error was " << result.error();
+
+    // Emitted one frame at a time, the object comes out exactly as if it had been serialized at once.
+    StreamSerializer<regulated::basics::Struct__0_1> serializer{obj};
+    uint8_t streamed[sizeof(contiguous)]{};
+    size_t streamed_size = 0U;
+    while (not serializer.done())
+    {
+        const auto chunk = serializer.next({&streamed[streamed_size], std::min<size_t>(7U, sizeof(streamed) - streamed_size)});
+        ASSERT_TRUE(chunk) << "Error was " << chunk.error();
+        streamed_size += chunk.value();
+    }
+    ASSERT_EQ(result.value(), streamed_size);
+    ASSERT_EQ(0, std::memcmp(&contiguous[0], &streamed[0], streamed_size));
+    const auto after_done = serializer.next({&streamed[0], sizeof(streamed)});
+    ASSERT_TRUE(after_done);
+    ASSERT_EQ(0U, after_done.value());
+
+    // Fed a few bytes at a time, the object is read back as deserialize() would read it.
+    regulated::basics::Struct__0_1 read{};
+    StreamDeserializer<regulated::basics::Struct__0_1> deserializer{read};
+    for (size_t i = 0U; i < result.value(); i += 3U)
+    {
+        const auto fed = deserializer.feed({&contiguous[i], std::min<size_t>(3U, result.value() - i)});
+        ASSERT_TRUE(fed) << "Error was " << fed.error();
+    }
+    const auto finished = deserializer.finish();
+    ASSERT_TRUE(finished) << "Error was " << finished.error();
+    ASSERT_EQ(result.value(), finished.value());
+    uint8_t reserialized[sizeof(contiguous)]{};
+    const auto reserialized_result = read.serialize(reserialized);
+    ASSERT_TRUE(reserialized_result) << "Error was " << reserialized_result.error();
+    ASSERT_EQ(result.value(), reserialized_result.value());
+    ASSERT_EQ(0, std::memcmp(&contiguous[0], &reserialized[0], result.value()));
+    ASSERT_TRUE(read.delimited_var_2[1].is_f64());
+
+    // A truncated input is zero-extended the same way.
+    for (size_t length = 0U; length < result.value(); ++length)
+    {
+        regulated::basics::Struct__0_1 expected{};
+        const auto expected_result = expected.deserialize({&contiguous[0], length});
+        regulated::basics::Struct__0_1 truncated{};
+        StreamDeserializer<regulated::basics::Struct__0_1> truncated_deserializer{truncated};
+        ASSERT_TRUE(truncated_deserializer.feed({&contiguous[0], length}));
+        const auto truncated_result = truncated_deserializer.finish();
+        if (not expected_result)
+        {
+            continue;
+        }
+        ASSERT_TRUE(truncated_result) << "Error was " << truncated_result.error() << " at length " << length;
+        ASSERT_EQ(expected_result.value(), truncated_result.value()) << "at length " << length;
+        uint8_t expected_bytes[sizeof(contiguous)]{};
+        uint8_t truncated_bytes[sizeof(contiguous)]{};
+        ASSERT_TRUE(expected.serialize(expected_bytes));
+        ASSERT_TRUE(truncated.serialize(truncated_bytes));
+        ASSERT_EQ(0, std::memcmp(&expected_bytes[0], &truncated_bytes[0], sizeof(contiguous))) << "at length " << length;
+    }
+}
+
+TEST(Streaming, Union)
+{
+    using namespace nunavut::support;
+    regulated::basics::DelimitedVariableSize_0_1 obj{};
+    obj.set_f32(1.5F);
+    uint8_t contiguous[regulated::basics::DelimitedVariableSize_0_1::SERIALIZATION_BUFFER_SIZE_BYTES]{};
+    const auto result = obj.serialize(contiguous);
+    ASSERT_TRUE(result) << "Error was " << result.error();
+
+    StreamSerializer<regulated::basics::DelimitedVariableSize_0_1> serializer{obj};
+    uint8_t streamed[sizeof(contiguous)]{};
+    const auto streamed_result = serializer.next({&streamed[0], sizeof(streamed)});
+    ASSERT_TRUE(streamed_result) << "Error was " << streamed_result.error();
+    ASSERT_TRUE(serializer.done());
+    ASSERT_EQ(result.value(), streamed_result.value());
+    ASSERT_EQ(0, std::memcmp(&contiguous[0], &streamed[0], result.value()));
+
+    regulated::basics::DelimitedVariableSize_0_1 read{};
+    StreamDeserializer<regulated::basics::DelimitedVariableSize_0_1> deserializer{read};
+    ASSERT_TRUE(deserializer.feed({&contiguous[0], result.value()}));
+    const auto finished = deserializer.finish();
+    ASSERT_TRUE(finished) << "Error was " << finished.error();
+    ASSERT_EQ(result.value(), finished.value());
+    ASSERT_TRUE(read.is_f32());
+    ASSERT_FLOAT_EQ(1.5F, read.get_f32());
+
+    // An unknown union tag is rejected.
+    contiguous[0] = 0xFF;
+    regulated::basics::DelimitedVariableSize_0_1 bad{};
+    StreamDeserializer<regulated::basics::DelimitedVariableSize_0_1> bad_deserializer{bad};
+    ASSERT_TRUE(bad_deserializer.feed({&contiguous[0], result.value()}));
+    const auto bad_result = bad_deserializer.finish();
+    ASSERT_FALSE(bad_result);
+    ASSERT_EQ(Error::REPRESENTATION_BAD_UNION_TAG, bad_result.error());
+}